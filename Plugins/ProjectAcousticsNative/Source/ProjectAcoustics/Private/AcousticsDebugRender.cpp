@@ -401,8 +401,51 @@ void FProjectAcousticsDebugRender::DrawStats()
         }
     }
 
+    TritonRuntime::TritonStats tritonStats;
+    if (m_Acoustics->GetTritonStats(tritonStats))
+    {
+        Panel.DrawText(
+            FString::Printf(
+                TEXT("Probes: [%d] in RAM, [%d] pending load, [%d] pending unload"), tritonStats.ProbesInRAM,
+                tritonStats.ProbesPendingLoad, tritonStats.ProbesPendingUnload),
+            FColor::White);
+        Panel.DrawText(
+            FString::Printf(
+                TEXT("Streaming: [%d] loaded, [%d] unloaded, [%d] load failures"), tritonStats.ProbesLoaded,
+                tritonStats.ProbesUnloaded, tritonStats.ProbesLoadFailed + tritonStats.NumStreamingFailed),
+            tritonStats.ProbesLoadFailed + tritonStats.NumStreamingFailed > 0 ? FColor::Red : FColor::White);
+        Panel.DrawText(
+            FString::Printf(
+                TEXT("Triton queries: [%d], [%d] failed, time avg [%.3f] max [%.3f] std dev [%.3f]"),
+                tritonStats.NumQueries, tritonStats.NumFailed, tritonStats.AvgQueryTime, tritonStats.MaxQueryTime,
+                tritonStats.StdDevQueryTime),
+            FColor::White);
+    }
+
     const auto memoryUsed = m_Acoustics->GetMemoryUsed();
     Panel.DrawText(FString::Printf(TEXT("RAM usage: [%d]MB"), memoryUsed >> 20), FColor::White);
+    const auto memoryReserved = m_Acoustics->GetMemoryReserved();
+    Panel.DrawText(
+        FString::Printf(
+            TEXT("RAM reserved: [%d]MB, [%d]MB in free pooled blocks"), memoryReserved >> 20,
+            FMath::Max(memoryReserved - memoryUsed, static_cast<int64>(0)) >> 20),
+        FColor::White);
+    const auto tileScale = m_Acoustics->GetTileEvictionScale();
+    if (tileScale < 1.0f)
+    {
+        Panel.DrawText(
+            FString::Printf(TEXT("Tiles scaled to [%d%%] by memory budget"), static_cast<int32>(tileScale * 100.0f)),
+            FColor::Yellow);
+    }
+    TArray<TritonRuntime::FTritonMemHook::FScopeMemory> memoryScopes;
+    m_Acoustics->GetMemoryScopes(memoryScopes);
+    for (const auto& scope : memoryScopes)
+    {
+        if (scope.BytesUsed > 0)
+        {
+            Panel.DrawText(FString::Printf(TEXT("    %s: [%d]KB"), *scope.Name, scope.BytesUsed >> 10), FColor::White);
+        }
+    }
     const auto diskBytesRead = m_Acoustics->GetDiskBytesRead();
     Panel.DrawText(FString::Printf(TEXT("Disk reads: [%d]MB"), diskBytesRead >> 20), FColor::White);
     Panel.DrawText(
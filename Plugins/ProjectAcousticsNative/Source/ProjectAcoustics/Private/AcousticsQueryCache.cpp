@@ -0,0 +1,81 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsQueryCache.h"
+
+DEFINE_STAT(STAT_Acoustics_QueryCacheHits);
+DEFINE_STAT(STAT_Acoustics_QueryCacheMisses);
+DEFINE_STAT(STAT_Acoustics_QueryCacheEntries);
+
+// Entries for old listener cells are never looked up again once the listener moves on. Rather than tracking them,
+// start over when the cache grows past this size.
+constexpr int32 c_MaxQueryCacheEntries = 4096;
+
+static FIntVector QuantizeLocation(const FVector& location, const float cellSize)
+{
+    return FIntVector(
+        FMath::FloorToInt(location.X / cellSize),
+        FMath::FloorToInt(location.Y / cellSize),
+        FMath::FloorToInt(location.Z / cellSize));
+}
+
+FAcousticsQueryCache::FKey FAcousticsQueryCache::MakeKey(
+    const FVector& sourceLocation, const FVector& listenerLocation, const uint8 resolver, const float cellSize)
+{
+    const auto safeCellSize = FMath::Max(cellSize, 1.0f);
+    return FKey{
+        QuantizeLocation(sourceLocation, safeCellSize), QuantizeLocation(listenerLocation, safeCellSize), resolver};
+}
+
+bool FAcousticsQueryCache::Find(const FKey& key, const uint32 maxAge, TritonAcousticParameters& outParams) const
+{
+    const auto currentTick = static_cast<uint32>(FPlatformAtomics::AtomicRead(&m_CurrentTick));
+    {
+        FReadScopeLock lock(m_Lock);
+        auto entry = m_Entries.Find(key);
+        if (entry != nullptr && currentTick - entry->Tick <= maxAge)
+        {
+            outParams = entry->Params;
+            INC_DWORD_STAT(STAT_Acoustics_QueryCacheHits);
+            return true;
+        }
+    }
+
+    INC_DWORD_STAT(STAT_Acoustics_QueryCacheMisses);
+    return false;
+}
+
+void FAcousticsQueryCache::Add(const FKey& key, const TritonAcousticParameters& params, const int32 generation)
+{
+    const auto currentTick = static_cast<uint32>(FPlatformAtomics::AtomicRead(&m_CurrentTick));
+
+    FWriteScopeLock lock(m_Lock);
+    if (generation != m_Generation)
+    {
+        return;
+    }
+    if (m_Entries.Num() >= c_MaxQueryCacheEntries)
+    {
+        m_Entries.Reset();
+    }
+    m_Entries.Add(key, FEntry{params, currentTick});
+}
+
+void FAcousticsQueryCache::Reset()
+{
+    FWriteScopeLock lock(m_Lock);
+    m_Entries.Reset();
+    FPlatformAtomics::InterlockedIncrement(&m_Generation);
+}
+
+void FAcousticsQueryCache::Tick()
+{
+    FPlatformAtomics::InterlockedIncrement(&m_CurrentTick);
+    SET_DWORD_STAT(STAT_Acoustics_QueryCacheEntries, Num());
+}
+
+int32 FAcousticsQueryCache::Num() const
+{
+    FReadScopeLock lock(m_Lock);
+    return m_Entries.Num();
+}
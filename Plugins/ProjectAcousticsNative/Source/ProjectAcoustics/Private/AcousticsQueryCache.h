@@ -0,0 +1,73 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "IAcoustics.h"
+#include "TritonApiTypes.h"
+
+// Shares acoustic query results between sources that are close to each other. Source and listener positions are
+// quantized to cells, and a successful query is reused for every other query that falls in the same pair of cells
+// with the same resolver, until it gets too old. Safe to use from multiple query workers at once.
+class FAcousticsQueryCache
+{
+public:
+    struct FKey
+    {
+        FIntVector SourceCell;
+        FIntVector ListenerCell;
+        uint8 Resolver;
+
+        bool operator==(const FKey& other) const
+        {
+            return SourceCell == other.SourceCell && ListenerCell == other.ListenerCell && Resolver == other.Resolver;
+        }
+
+        friend uint32 GetTypeHash(const FKey& key)
+        {
+            return HashCombine(HashCombine(GetTypeHash(key.SourceCell), GetTypeHash(key.ListenerCell)), key.Resolver);
+        }
+    };
+
+    static FKey MakeKey(
+        const FVector& sourceLocation, const FVector& listenerLocation, const uint8 resolver, const float cellSize);
+
+    // Returns true and fills outParams if there is an entry for key that is at most maxAge ticks old
+    bool Find(const FKey& key, const uint32 maxAge, TritonAcousticParameters& outParams) const;
+    // Adds the results of a query that started while the cache was at the given generation. Results of queries that
+    // started before the last Reset are dropped, since they may come from the data that was reset away.
+    void Add(const FKey& key, const TritonAcousticParameters& params, const int32 generation);
+
+    // Drop all entries. Used whenever the loaded acoustic data or its placement in the world changes.
+    void Reset();
+
+    // Take this before running a query whose results will be added
+    int32 GetGeneration() const
+    {
+        return FPlatformAtomics::AtomicRead(&m_Generation);
+    }
+
+    // Called once per game tick to age the entries
+    void Tick();
+
+    int32 Num() const;
+
+private:
+    struct FEntry
+    {
+        TritonAcousticParameters Params;
+        uint32 Tick;
+    };
+
+    TMap<FKey, FEntry> m_Entries;
+    mutable FRWLock m_Lock;
+    volatile int32 m_CurrentTick = 0;
+    // Bumped by every Reset, under the write lock
+    volatile int32 m_Generation = 0;
+};
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query Cache Hits"), STAT_Acoustics_QueryCacheHits, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query Cache Misses"), STAT_Acoustics_QueryCacheMisses, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query Cache Entries"), STAT_Acoustics_QueryCacheEntries, STATGROUP_Acoustics, );
@@ -4,6 +4,9 @@
 #include "AcousticsRuntimeVolume.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Components/BrushComponent.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Engine/World.h"
+#include "IAcoustics.h"
 
 AAcousticsRuntimeVolume::AAcousticsRuntimeVolume(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -12,10 +15,90 @@ AAcousticsRuntimeVolume::AAcousticsRuntimeVolume(const FObjectInitializer& Objec
     OverrideDesignParams.WetnessAdjustment = 0.0f;
     OverrideDesignParams.DecayTimeMultiplier = 1.0f;
     OverrideDesignParams.OutdoornessAdjustment = 0.0f;
+    m_Acoustics = nullptr;
+
+    // Ticks to pass design param changes made at runtime on to the acoustics system
+    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = true;
 
     // Disable blocking collision
     if (UPrimitiveComponent* PrimitiveComponent = FindComponentByClass<UPrimitiveComponent>())
     {
         PrimitiveComponent->SetCollisionResponseToAllChannels(ECR_Overlap);
     }
+}
+
+void AAcousticsRuntimeVolume::BeginPlay()
+{
+    Super::BeginPlay();
+    if (IAcoustics::IsAvailable())
+    {
+        // cache module instance
+        m_Acoustics = &(IAcoustics::Get());
+        RegisterWithAcoustics();
+    }
+}
+
+void AAcousticsRuntimeVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Unregister this volume
+    if (m_Acoustics)
+    {
+        m_Acoustics->RemoveRuntimeVolume(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AAcousticsRuntimeVolume::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    if (m_Acoustics == nullptr)
+    {
+        return;
+    }
+
+    if (!GetActorTransform().Equals(m_RegisteredTransform))
+    {
+        RegisterWithAcoustics();
+    }
+    else if (
+        FMemory::Memcmp(&OverrideDesignParams, &m_RegisteredDesignParams, sizeof(FAcousticsDesignParams)) != 0)
+    {
+        m_RegisteredDesignParams = OverrideDesignParams;
+        m_Acoustics->UpdateRuntimeVolume(this, OverrideDesignParams);
+    }
+}
+
+void AAcousticsRuntimeVolume::RegisterWithAcoustics()
+{
+    auto brush = GetBrushComponent();
+    auto world = GetWorld();
+    if (brush == nullptr || world == nullptr)
+    {
+        return;
+    }
+
+    // The brush's collision is made of convex elements. Transform their planes to world space once here, so that
+    // sources only need a few plane tests.
+    TArray<TArray<FPlane>> hulls;
+    if (brush->BrushBodySetup != nullptr)
+    {
+        const auto& componentTransform = brush->GetComponentTransform();
+        for (const auto& convex : brush->BrushBodySetup->AggGeom.ConvexElems)
+        {
+            const auto toWorld = (convex.GetTransform() * componentTransform).ToMatrixWithScale();
+            auto& hull = hulls.AddDefaulted_GetRef();
+            convex.GetPlanes(hull);
+            for (auto& plane : hull)
+            {
+                plane = plane.TransformBy(toWorld);
+            }
+        }
+    }
+
+    m_RegisteredTransform = GetActorTransform();
+    m_RegisteredDesignParams = OverrideDesignParams;
+    m_Acoustics->AddRuntimeVolume(this, world->GetUniqueID(), brush->Bounds.GetBox(), hulls, OverrideDesignParams);
 }
\ No newline at end of file
@@ -0,0 +1,193 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsRuntimeVolumeIndex.h"
+
+// Leaves hold at most this many volumes
+constexpr int32 c_MaxVolumesPerLeaf = 2;
+// The hierarchy is split at the median, so its depth stays far below this for any realistic number of volumes
+constexpr int32 c_MaxVolumeIndexDepth = 64;
+// Points this close to a hull's surface count as inside, like the zero radius overlap this index replaces
+constexpr float c_VolumeSurfaceTolerance = 0.01f;
+
+void FAcousticsRuntimeVolumeIndex::Add(
+    const uint64 volumeId, const uint32 worldId, const FBox& bounds, const TArray<TArray<FPlane>>& hulls,
+    const FAcousticsDesignParams& overrideParams)
+{
+    FVolume volume;
+    volume.VolumeId = volumeId;
+    volume.WorldId = worldId;
+    volume.Bounds = bounds;
+    volume.OverrideParams = overrideParams;
+    for (const auto& hull : hulls)
+    {
+        // A hull without planes would contain every point
+        if (hull.Num() > 0)
+        {
+            volume.Planes.Append(hull);
+            volume.HullEnds.Add(volume.Planes.Num());
+        }
+    }
+
+    FWriteScopeLock lock(m_Lock);
+    auto existing = m_Volumes.FindByPredicate([volumeId](const FVolume& v) { return v.VolumeId == volumeId; });
+    if (existing != nullptr)
+    {
+        *existing = MoveTemp(volume);
+    }
+    else
+    {
+        m_Volumes.Add(MoveTemp(volume));
+    }
+    Rebuild();
+}
+
+bool FAcousticsRuntimeVolumeIndex::Remove(const uint64 volumeId)
+{
+    FWriteScopeLock lock(m_Lock);
+    const auto numRemoved =
+        m_Volumes.RemoveAllSwap([volumeId](const FVolume& v) { return v.VolumeId == volumeId; });
+    if (numRemoved == 0)
+    {
+        return false;
+    }
+    Rebuild();
+    return true;
+}
+
+bool FAcousticsRuntimeVolumeIndex::UpdateDesignParams(
+    const uint64 volumeId, const FAcousticsDesignParams& overrideParams)
+{
+    // Only the parameters change, the hierarchy stays as it is
+    FWriteScopeLock lock(m_Lock);
+    auto existing = m_Volumes.FindByPredicate([volumeId](const FVolume& v) { return v.VolumeId == volumeId; });
+    if (existing == nullptr)
+    {
+        return false;
+    }
+    existing->OverrideParams = overrideParams;
+    return true;
+}
+
+void FAcousticsRuntimeVolumeIndex::ApplyOverrides(
+    const uint32 worldId, const FVector& location, FAcousticsDesignParams& designParams) const
+{
+    FReadScopeLock lock(m_Lock);
+    if (m_Nodes.Num() == 0)
+    {
+        return;
+    }
+
+    int32 stack[c_MaxVolumeIndexDepth];
+    auto stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0)
+    {
+        const auto nodeIndex = stack[--stackSize];
+        const auto& node = m_Nodes[nodeIndex];
+        if (!node.Bounds.IsInsideOrOn(location))
+        {
+            continue;
+        }
+
+        if (node.NumVolumes > 0)
+        {
+            for (auto i = node.FirstVolume; i < node.FirstVolume + node.NumVolumes; i++)
+            {
+                const auto& volume = m_Volumes[m_NodeVolumes[i]];
+                if (volume.WorldId == worldId && Contains(volume, location))
+                {
+                    // Apply the override parameters and save to the object's design params
+                    FAcousticsDesignParams::Combine(designParams, volume.OverrideParams);
+                }
+            }
+        }
+        else if (stackSize + 2 <= c_MaxVolumeIndexDepth)
+        {
+            stack[stackSize++] = node.SecondChild;
+            stack[stackSize++] = nodeIndex + 1;
+        }
+    }
+}
+
+int32 FAcousticsRuntimeVolumeIndex::Num() const
+{
+    FReadScopeLock lock(m_Lock);
+    return m_Volumes.Num();
+}
+
+bool FAcousticsRuntimeVolumeIndex::Contains(const FVolume& volume, const FVector& location)
+{
+    if (!volume.Bounds.IsInsideOrOn(location))
+    {
+        return false;
+    }
+    if (volume.HullEnds.Num() == 0)
+    {
+        return true;
+    }
+
+    auto hullBegin = 0;
+    for (const auto hullEnd : volume.HullEnds)
+    {
+        auto isInside = true;
+        for (auto i = hullBegin; i < hullEnd && isInside; i++)
+        {
+            isInside = volume.Planes[i].PlaneDot(location) <= c_VolumeSurfaceTolerance;
+        }
+        if (isInside)
+        {
+            return true;
+        }
+        hullBegin = hullEnd;
+    }
+    return false;
+}
+
+// Must be called with the write lock held
+void FAcousticsRuntimeVolumeIndex::Rebuild()
+{
+    m_Nodes.Reset();
+    m_NodeVolumes.Reset();
+    for (auto i = 0; i < m_Volumes.Num(); i++)
+    {
+        m_NodeVolumes.Add(i);
+    }
+    if (m_Volumes.Num() > 0)
+    {
+        BuildNode(0, m_Volumes.Num());
+    }
+}
+
+void FAcousticsRuntimeVolumeIndex::BuildNode(const int32 begin, const int32 end)
+{
+    FBox bounds(ForceInit);
+    FBox centers(ForceInit);
+    for (auto i = begin; i < end; i++)
+    {
+        const auto& volumeBounds = m_Volumes[m_NodeVolumes[i]].Bounds;
+        bounds += volumeBounds;
+        centers += volumeBounds.GetCenter();
+    }
+
+    const auto nodeIndex = m_Nodes.Add(FNode{bounds, begin, 0, INDEX_NONE});
+    if (end - begin <= c_MaxVolumesPerLeaf)
+    {
+        m_Nodes[nodeIndex].NumVolumes = end - begin;
+        return;
+    }
+
+    // Split at the median along the axis the volumes are spread out the most
+    const auto spread = centers.GetSize();
+    const auto axis = spread.X >= spread.Y && spread.X >= spread.Z ? 0 : (spread.Y >= spread.Z ? 1 : 2);
+    Sort(
+        m_NodeVolumes.GetData() + begin,
+        end - begin,
+        [this, axis](const int32 a, const int32 b)
+        { return m_Volumes[a].Bounds.GetCenter()[axis] < m_Volumes[b].Bounds.GetCenter()[axis]; });
+
+    const auto middle = begin + (end - begin) / 2;
+    BuildNode(begin, middle);
+    m_Nodes[nodeIndex].SecondChild = m_Nodes.Num();
+    BuildNode(middle, end);
+}
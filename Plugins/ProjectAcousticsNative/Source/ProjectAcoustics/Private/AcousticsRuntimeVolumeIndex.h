@@ -0,0 +1,59 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AcousticsDesignParams.h"
+
+// Spatial index of the AcousticsRuntimeVolumes in play, so that design overrides can be looked up for a point without
+// a physics scene query. Volumes are kept in a bounding volume hierarchy that is rebuilt whenever a volume is added,
+// moved or removed, which only happens on the game thread. Lookups are safe from any thread.
+class FAcousticsRuntimeVolumeIndex
+{
+public:
+    // Adds the volume, or replaces its shape if it was already added. A point is inside the volume if it is inside
+    // any of the hulls, each given as a list of outward facing planes. Volumes without hulls are treated as boxes.
+    void Add(
+        const uint64 volumeId, const uint32 worldId, const FBox& bounds, const TArray<TArray<FPlane>>& hulls,
+        const FAcousticsDesignParams& overrideParams);
+    bool Remove(const uint64 volumeId);
+    bool UpdateDesignParams(const uint64 volumeId, const FAcousticsDesignParams& overrideParams);
+
+    // Combines the overrides of every volume in the given world that contains location into designParams
+    void ApplyOverrides(const uint32 worldId, const FVector& location, FAcousticsDesignParams& designParams) const;
+
+    int32 Num() const;
+
+private:
+    struct FVolume
+    {
+        uint64 VolumeId;
+        uint32 WorldId;
+        FBox Bounds;
+        // Planes of all hulls back to back. HullEnds holds the index one past the last plane of each hull.
+        TArray<FPlane> Planes;
+        TArray<int32> HullEnds;
+        FAcousticsDesignParams OverrideParams;
+    };
+
+    // Nodes are stored depth first, so the first child of a node is the next node
+    struct FNode
+    {
+        FBox Bounds;
+        // Leaves reference m_NodeVolumes[FirstVolume, FirstVolume + NumVolumes), inner nodes have NumVolumes 0
+        int32 FirstVolume;
+        int32 NumVolumes;
+        int32 SecondChild;
+    };
+
+    static bool Contains(const FVolume& volume, const FVector& location);
+    void Rebuild();
+    void BuildNode(const int32 begin, const int32 end);
+
+    TArray<FVolume> m_Volumes;
+    TArray<FNode> m_Nodes;
+    // Volume indices, ordered so that every leaf owns a contiguous range
+    TArray<int32> m_NodeVolumes;
+    mutable FRWLock m_Lock;
+};
@@ -0,0 +1,95 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsShardedCounter.h"
+
+// Shard indices in use by live threads, one bit each. Shared by all counters, since a thread uses the same index in
+// every one of them.
+static volatile int64 s_UsedShards = 0;
+
+// Claims a shard index for the thread on first use and gives it back when the thread exits. What the thread added
+// stays in the shard, and the next thread to claim it adds on top.
+struct FAcousticsThreadShard
+{
+    int32 Index = INDEX_NONE;
+    bool IsClaimed = false;
+
+    int32 Claim()
+    {
+        IsClaimed = true;
+        auto used = FPlatformAtomics::AtomicRead(&s_UsedShards);
+        for (auto i = 0; i < FAcousticsShardedCounter::c_NumShards;)
+        {
+            const auto bit = static_cast<int64>(1) << i;
+            if ((used & bit) != 0)
+            {
+                i++;
+                continue;
+            }
+            const auto previous = FPlatformAtomics::InterlockedCompareExchange(&s_UsedShards, used | bit, used);
+            if (previous == used)
+            {
+                Index = i;
+                break;
+            }
+            // Another thread claimed or released a shard in the meantime, look again
+            used = previous;
+            i = 0;
+        }
+        return Index;
+    }
+
+    ~FAcousticsThreadShard()
+    {
+        if (Index == INDEX_NONE)
+        {
+            return;
+        }
+        const auto bit = static_cast<int64>(1) << Index;
+        auto used = FPlatformAtomics::AtomicRead(&s_UsedShards);
+        for (;;)
+        {
+            const auto previous = FPlatformAtomics::InterlockedCompareExchange(&s_UsedShards, used & ~bit, used);
+            if (previous == used)
+            {
+                break;
+            }
+            used = previous;
+        }
+    }
+};
+
+static thread_local FAcousticsThreadShard s_ThreadShard;
+
+FAcousticsShardedCounter::FAcousticsShardedCounter()
+{
+    for (auto& shard : m_Shards)
+    {
+        shard.Value = 0;
+    }
+}
+
+void FAcousticsShardedCounter::Add(const int64 delta)
+{
+    auto& threadShard = s_ThreadShard;
+    const auto index = threadShard.IsClaimed ? threadShard.Index : threadShard.Claim();
+    if (index != INDEX_NONE)
+    {
+        auto& value = m_Shards[index].Value;
+        FPlatformAtomics::AtomicStore_Relaxed(&value, FPlatformAtomics::AtomicRead_Relaxed(&value) + delta);
+    }
+    else
+    {
+        FPlatformAtomics::InterlockedAdd(&m_Shards[c_NumShards].Value, delta);
+    }
+}
+
+int64 FAcousticsShardedCounter::Get() const
+{
+    int64 total = 0;
+    for (const auto& shard : m_Shards)
+    {
+        total += FPlatformAtomics::AtomicRead_Relaxed(&shard.Value);
+    }
+    return total;
+}
@@ -0,0 +1,33 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// A counter that many threads can add to without contending. Each thread gets a shard of its own while it lives, and
+// is the only one writing to it, so adding is a plain load and store instead of an interlocked operation. Threads past
+// the number of shards share one more shard through interlocked adds. Get sums the shards, so it costs more than Add
+// and sees each thread's adds a little late.
+class FAcousticsShardedCounter
+{
+public:
+    static constexpr int32 c_NumShards = 32;
+
+    FAcousticsShardedCounter();
+
+    FAcousticsShardedCounter(const FAcousticsShardedCounter&) = delete;
+    FAcousticsShardedCounter& operator=(const FAcousticsShardedCounter&) = delete;
+
+    void Add(const int64 delta);
+    int64 Get() const;
+
+private:
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+    {
+        volatile int64 Value;
+    };
+
+    // The last shard is the shared one
+    FShard m_Shards[c_NumShards + 1];
+};
@@ -7,6 +7,11 @@
 #include "GameFramework/HUD.h"
 #include "GameFramework/PlayerController.h"
 
+// Time constant of the smoothing applied to the listener velocity, in seconds
+constexpr float c_ListenerVelocitySmoothingTime = 0.25f;
+// Listener moves longer than this fraction of the tile size within a frame are treated as teleports, not motion
+constexpr float c_ListenerTeleportTileFraction = 0.5f;
+
 // Console commands for toggling debug info
 static TAutoConsoleVariable<int32>
     CVarAcousticsDrawVoxels(TEXT("PA.DrawVoxels"), 0, TEXT("Show Project Acoustics voxels?"));
@@ -39,6 +44,8 @@ AAcousticsSpace::AAcousticsSpace(const FObjectInitializer& ObjectInitializer)
     // Main parameters
     TileSize = FVector(5000, 5000, 5000);
     AutoStream = true;
+    AdditiveLoad = false;
+    StreamingPredictionHorizon = 0.0f;
     UpdateDistances = false;
     CacheScale = 1.0f;
 
@@ -66,6 +73,14 @@ void AAcousticsSpace::BeginPlay()
         // cache module instance
         m_Acoustics = &(IAcoustics::Get());
 
+        if (AdditiveLoad)
+        {
+            // Additive spaces only contribute their ACE file, the persistent level's space does the rest
+            SetActorTickEnabled(false);
+            LoadAcousticsData(AcousticsData);
+            return;
+        }
+
         m_LastSpaceTransform = GetActorTransform();
         m_Acoustics->SetSpaceTransform(m_LastSpaceTransform);
 
@@ -149,23 +164,30 @@ void AAcousticsSpace::Tick(float deltaSeconds)
             m_LastSpaceTransform = currentTx;
         }
 
-        auto listenerPosition = GetListenerPosition();
+        UpdateListenerPositions();
+        UpdateListenerVelocities(deltaSeconds);
+        m_Acoustics->SetListenerLocations(m_ListenerPositions);
 
-        // Update streaming
+        // Update streaming. Every listener keeps a tile loaded around it, so switching focus between split-screen
+        // players doesn't reload anything.
         if (AutoStream)
         {
-            m_Acoustics->UpdateLoadedRegion(listenerPosition, TileSize, false, true, false);
+            m_Acoustics->UpdateLoadedRegions(
+                m_ListenerPositions, m_ListenerVelocities, StreamingPredictionHorizon, TileSize, false, true, false);
         }
 
         // If there are active emitters in the scene, they will
         // update outdoorness each frame automatically. But if there are
         // no active emitters this frame, we hand-crank outdoorness.
-        m_Acoustics->UpdateOutdoorness(listenerPosition);
+        for (const auto& listenerPosition : m_ListenerPositions)
+        {
+            m_Acoustics->UpdateOutdoorness(listenerPosition);
+        }
 
-        // Update distances
+        // Update distances. Triton keeps a single distance map, which follows the first listener.
         if (UpdateDistances)
         {
-            m_Acoustics->UpdateDistances(listenerPosition);
+            m_Acoustics->UpdateDistances(m_ListenerPositions[0]);
         }
     }
 
@@ -173,10 +195,71 @@ void AAcousticsSpace::Tick(float deltaSeconds)
     m_Acoustics->PostTick();
 }
 
+// Get location of every local listener, such as one per split-screen player. There is always at least one.
+void AAcousticsSpace::UpdateListenerPositions()
+{
+    m_ListenerPositions.Reset();
+    for (auto it = GetWorld()->GetPlayerControllerIterator(); it; ++it)
+    {
+        const auto playerController = it->Get();
+        if (playerController != nullptr && playerController->IsLocalController())
+        {
+            FVector Location, Front, Right;
+            playerController->GetAudioListenerPosition(Location, Front, Right);
+            m_ListenerPositions.Add(Location);
+        }
+    }
+    if (m_ListenerPositions.Num() == 0)
+    {
+        m_ListenerPositions.Add(GetListenerPosition());
+    }
+}
+
+void AAcousticsSpace::UpdateListenerVelocities(const float deltaSeconds)
+{
+    // Start over when listeners come or go, since they can't be matched up with the previous ones
+    if (m_LastListenerPositions.Num() != m_ListenerPositions.Num())
+    {
+        m_LastListenerPositions = m_ListenerPositions;
+        m_ListenerVelocities.Init(FVector::ZeroVector, m_ListenerPositions.Num());
+        return;
+    }
+
+    for (auto i = 0; i < m_ListenerPositions.Num() && deltaSeconds > 0.0f; i++)
+    {
+        const auto& listenerPosition = m_ListenerPositions[i];
+        auto& listenerVelocity = m_ListenerVelocities[i];
+        const auto displacement = listenerPosition - m_LastListenerPositions[i];
+        const auto distance = displacement.GetAbs();
+        const auto teleportDistance = TileSize.GetAbs() * c_ListenerTeleportTileFraction;
+        if (distance.X <= teleportDistance.X && distance.Y <= teleportDistance.Y && distance.Z <= teleportDistance.Z)
+        {
+            // Exponential smoothing that behaves the same at any frame rate
+            const auto alpha = 1.0f - FMath::Exp(-deltaSeconds / c_ListenerVelocitySmoothingTime);
+            listenerVelocity = FMath::Lerp(listenerVelocity, displacement / deltaSeconds, alpha);
+        }
+        else
+        {
+            listenerVelocity = FVector::ZeroVector;
+        }
+    }
+    m_LastListenerPositions = m_ListenerPositions;
+}
+
+void AAcousticsSpace::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (m_Acoustics && !m_AddedAceFilePath.IsEmpty())
+    {
+        m_Acoustics->RemoveAceFile(m_AddedAceFilePath);
+        m_AddedAceFilePath.Reset();
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
 void AAcousticsSpace::BeginDestroy()
 {
     Super::BeginDestroy();
-    if (m_Acoustics)
+    if (m_Acoustics && !AdditiveLoad)
     {
         m_Acoustics->UnloadAceFile(true);
     }
@@ -215,7 +298,15 @@ bool AAcousticsSpace::LoadAcousticsData(UAcousticsData* newData)
     AcousticsData = newData;
     if (newData == nullptr)
     {
-        if (m_Acoustics)
+        if (m_Acoustics && AdditiveLoad)
+        {
+            if (!m_AddedAceFilePath.IsEmpty())
+            {
+                m_Acoustics->RemoveAceFile(m_AddedAceFilePath);
+                m_AddedAceFilePath.Reset();
+            }
+        }
+        else if (m_Acoustics)
         {
             m_Acoustics->UnloadAceFile(false);
         }
@@ -232,6 +323,23 @@ bool AAcousticsSpace::LoadAceFile(FString filePath)
         return false;
     }
 
+    if (AdditiveLoad)
+    {
+        // Swap out the file this space added before, if any
+        if (!m_AddedAceFilePath.IsEmpty())
+        {
+            m_Acoustics->RemoveAceFile(m_AddedAceFilePath);
+        }
+        // Streaming picks up the added file from the regions that are already loaded
+        m_AddedAceFilePath = filePath;
+        if (!m_Acoustics->AddAceFile(filePath, CacheScale))
+        {
+            UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to add ACE file [%s]"), *filePath);
+            return false;
+        }
+        return true;
+    }
+
     auto success = m_Acoustics->LoadAceFile(filePath, CacheScale);
     if (success)
     {
@@ -0,0 +1,57 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsTaskCounter.h"
+#include "HAL/PlatformProcess.h"
+
+FAcousticsTaskCounter::FAcousticsTaskCounter()
+    : m_Count(0), m_IdleEvent(FPlatformProcess::GetSynchEventFromPool(true))
+{
+    m_IdleEvent->Trigger();
+}
+
+FAcousticsTaskCounter::~FAcousticsTaskCounter()
+{
+    FPlatformProcess::ReturnSynchEventToPool(m_IdleEvent);
+    m_IdleEvent = nullptr;
+}
+
+void FAcousticsTaskCounter::Increment()
+{
+    FScopeLock lock(&m_Lock);
+    if (FPlatformAtomics::InterlockedIncrement(&m_Count) == 1)
+    {
+        m_IdleEvent->Reset();
+    }
+}
+
+void FAcousticsTaskCounter::Decrement()
+{
+    FScopeLock lock(&m_Lock);
+    const auto count = FPlatformAtomics::InterlockedDecrement(&m_Count);
+    check(count >= 0);
+    if (count == 0)
+    {
+        m_IdleEvent->Trigger();
+    }
+}
+
+bool FAcousticsTaskCounter::Wait(const double timeoutSeconds) const
+{
+    const auto endTime = FPlatformTime::Seconds() + timeoutSeconds;
+    while (GetCount() > 0)
+    {
+        const auto remainingSeconds = endTime - FPlatformTime::Seconds();
+        if (remainingSeconds <= 0.0)
+        {
+            return false;
+        }
+        // A new task can start right after the event was triggered, so check the count again after waking up
+        m_IdleEvent->Wait(FMath::Max(static_cast<uint32>(remainingSeconds * 1000.0), 1u));
+    }
+
+    // The thread that brought the count to zero may still be holding the lock. Once it has let go, the counter can be
+    // destroyed.
+    FScopeLock lock(&m_Lock);
+    return true;
+}
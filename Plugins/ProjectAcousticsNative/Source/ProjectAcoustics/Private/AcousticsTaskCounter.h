@@ -0,0 +1,38 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Event.h"
+
+// Counts outstanding background tasks and lets other threads sleep until all of them have completed. Increment and
+// Decrement can be called from any thread. Once Wait has returned true, the counter can be destroyed as long as no new
+// tasks are started.
+class FAcousticsTaskCounter
+{
+public:
+    FAcousticsTaskCounter();
+    ~FAcousticsTaskCounter();
+
+    FAcousticsTaskCounter(const FAcousticsTaskCounter&) = delete;
+    FAcousticsTaskCounter& operator=(const FAcousticsTaskCounter&) = delete;
+
+    void Increment();
+    void Decrement();
+
+    int32 GetCount() const
+    {
+        return FPlatformAtomics::AtomicRead(&m_Count);
+    }
+
+    // Blocks until the count reaches zero or timeoutSeconds have passed. Returns true if the count reached zero.
+    bool Wait(const double timeoutSeconds) const;
+
+private:
+    volatile int32 m_Count;
+    // Manual reset, triggered while the count is zero
+    FEvent* m_IdleEvent;
+    // Count changes and the event state move together under this lock
+    mutable FCriticalSection m_Lock;
+};
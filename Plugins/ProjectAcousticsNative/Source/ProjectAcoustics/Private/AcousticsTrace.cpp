@@ -0,0 +1,88 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsTraceEvents.h"
+
+UE_TRACE_CHANNEL_DEFINE(AcousticsChannel);
+
+UE_TRACE_EVENT_BEGIN(Acoustics, Query)
+    UE_TRACE_EVENT_FIELD(uint64, QueuedCycle)
+    UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+    UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+    UE_TRACE_EVENT_FIELD(uint32, SourceId)
+    UE_TRACE_EVENT_FIELD(uint8, Succeeded)
+    UE_TRACE_EVENT_FIELD(uint8, Batched)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Acoustics, TileLoad)
+    UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+    UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+    UE_TRACE_EVENT_FIELD(double, CenterX)
+    UE_TRACE_EVENT_FIELD(double, CenterY)
+    UE_TRACE_EVENT_FIELD(double, CenterZ)
+    UE_TRACE_EVENT_FIELD(double, SizeX)
+    UE_TRACE_EVENT_FIELD(double, SizeY)
+    UE_TRACE_EVENT_FIELD(double, SizeZ)
+    UE_TRACE_EVENT_FIELD(int64, BytesRead)
+    UE_TRACE_EVENT_FIELD(int32, NumProbes)
+    UE_TRACE_EVENT_FIELD(uint8, Blocking)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Acoustics, StreamingTask)
+    UE_TRACE_EVENT_FIELD(uint64, QueuedCycle)
+    UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+    UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+    UE_TRACE_EVENT_FIELD(int64, BytesRead)
+    UE_TRACE_EVENT_FIELD(uint32, TaskId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Acoustics, SourceStaleness)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint32, SourceId)
+    UE_TRACE_EVENT_FIELD(int32, TicksSinceFreshResult)
+UE_TRACE_EVENT_END()
+
+namespace AcousticsTrace
+{
+    bool IsEnabled()
+    {
+        return UE_TRACE_CHANNELEXPR_IS_ENABLED(AcousticsChannel);
+    }
+
+    void OutputQuery(
+        const uint32 sourceId, const uint64 queuedCycles, const uint64 startCycles, const uint64 endCycles,
+        const bool succeeded, const bool batched)
+    {
+        UE_TRACE_LOG(Acoustics, Query, AcousticsChannel)
+            << Query.QueuedCycle(queuedCycles) << Query.StartCycle(startCycles) << Query.EndCycle(endCycles)
+            << Query.SourceId(sourceId) << Query.Succeeded(succeeded ? 1 : 0) << Query.Batched(batched ? 1 : 0);
+    }
+
+    void OutputTileLoad(
+        const FVector& center, const FVector& size, const uint64 startCycles, const uint64 endCycles,
+        const int32 numProbes, const int64 bytesRead, const bool blocking)
+    {
+        UE_TRACE_LOG(Acoustics, TileLoad, AcousticsChannel)
+            << TileLoad.StartCycle(startCycles) << TileLoad.EndCycle(endCycles) << TileLoad.CenterX(center.X)
+            << TileLoad.CenterY(center.Y) << TileLoad.CenterZ(center.Z) << TileLoad.SizeX(size.X)
+            << TileLoad.SizeY(size.Y) << TileLoad.SizeZ(size.Z) << TileLoad.BytesRead(bytesRead)
+            << TileLoad.NumProbes(numProbes) << TileLoad.Blocking(blocking ? 1 : 0);
+    }
+
+    void OutputStreamingTask(
+        const uint32 taskId, const uint64 queuedCycles, const uint64 startCycles, const uint64 endCycles,
+        const int64 bytesRead)
+    {
+        UE_TRACE_LOG(Acoustics, StreamingTask, AcousticsChannel)
+            << StreamingTask.QueuedCycle(queuedCycles) << StreamingTask.StartCycle(startCycles)
+            << StreamingTask.EndCycle(endCycles) << StreamingTask.BytesRead(bytesRead)
+            << StreamingTask.TaskId(taskId);
+    }
+
+    void OutputSourceStaleness(const uint32 sourceId, const int32 ticksSinceFreshResult)
+    {
+        UE_TRACE_LOG(Acoustics, SourceStaleness, AcousticsChannel)
+            << SourceStaleness.Cycle(FPlatformTime::Cycles64()) << SourceStaleness.SourceId(sourceId)
+            << SourceStaleness.TicksSinceFreshResult(ticksSinceFreshResult);
+    }
+} // namespace AcousticsTrace
@@ -0,0 +1,33 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "AcousticsTrace.h"
+
+// Events on the acoustics trace channel. Times are in FPlatformTime::Cycles64, the same clock Insights uses, so they
+// line up with the frames and CPU timers of the capture. All of these do nothing unless the channel is enabled.
+namespace AcousticsTrace
+{
+    bool IsEnabled();
+
+    // One acoustic query for a source. The query waited in its worker's queue from queuedCycles to startCycles and
+    // ran until endCycles. Batched queries count as queued from when their batch went out.
+    void OutputQuery(
+        const uint32 sourceId, const uint64 queuedCycles, const uint64 startCycles, const uint64 endCycles,
+        const bool succeeded, const bool batched);
+
+    // One call to Triton's LoadRegion. Non-blocking loads only queue up streaming tasks, which read the probes
+    // later, so only blocking loads read anything during the call.
+    void OutputTileLoad(
+        const FVector& center, const FVector& size, const uint64 startCycles, const uint64 endCycles,
+        const int32 numProbes, const int64 bytesRead, const bool blocking);
+
+    // One Triton streaming task, which is where the probes of non-blocking tile loads are read
+    void OutputStreamingTask(
+        const uint32 taskId, const uint64 queuedCycles, const uint64 startCycles, const uint64 endCycles,
+        const int64 bytesRead);
+
+    // Audio ticks since the source last got a fresh query result, sent on every update of the source
+    void OutputSourceStaleness(const uint32 sourceId, const int32 ticksSinceFreshResult);
+} // namespace AcousticsTrace
@@ -5,8 +5,11 @@
 #include "ProjectAcoustics.h"
 #include "IAcoustics.h"
 #include "AcousticsDebugRender.h"
+#include "AcousticsRuntimeSettings.h"
 #include "Misc/Paths.h"
 #include "Logging/StructuredLog.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "AcousticsTraceEvents.h"
 
 using namespace TritonRuntime;
 
@@ -19,6 +22,35 @@ DEFINE_STAT(STAT_Acoustics_QueryOutdoorness);
 DEFINE_STAT(STAT_Acoustics_LoadRegion);
 DEFINE_STAT(STAT_Acoustics_LoadAce);
 DEFINE_STAT(STAT_Acoustics_ClearAce);
+DEFINE_STAT(STAT_Acoustics_WarmUpQueries);
+DEFINE_STAT(STAT_Acoustics_SyncFirstQueries);
+DEFINE_STAT(STAT_Acoustics_FirstQueryCacheHits);
+DEFINE_STAT(STAT_Acoustics_FirstQueryCacheMisses);
+DEFINE_STAT(STAT_Acoustics_StreamingQueueDepth);
+DEFINE_STAT(STAT_Acoustics_StreamingBacklogKB);
+DEFINE_STAT(STAT_Acoustics_StreamingProbesRequested);
+DEFINE_STAT(STAT_Acoustics_Evictions);
+DEFINE_STAT(STAT_Acoustics_TileEvictionScale);
+DEFINE_STAT(STAT_Acoustics_TritonProbesInRAM);
+DEFINE_STAT(STAT_Acoustics_TritonProbesPendingLoad);
+DEFINE_STAT(STAT_Acoustics_TritonProbesPendingUnload);
+DEFINE_STAT(STAT_Acoustics_TritonProbesLoaded);
+DEFINE_STAT(STAT_Acoustics_TritonProbesLoadFailed);
+DEFINE_STAT(STAT_Acoustics_TritonProbesUnloaded);
+DEFINE_STAT(STAT_Acoustics_TritonFailedQueries);
+DEFINE_STAT(STAT_Acoustics_TritonStreamingFailures);
+DEFINE_STAT(STAT_Acoustics_TritonAvgQueryTime);
+DEFINE_STAT(STAT_Acoustics_TritonMaxQueryTime);
+DEFINE_STAT(STAT_Acoustics_TritonStdDevQueryTime);
+
+TRACE_DECLARE_INT_COUNTER(Acoustics_TritonProbesInRAM, TEXT("Acoustics/Triton/Probes In RAM"));
+TRACE_DECLARE_INT_COUNTER(Acoustics_TritonProbesPendingLoad, TEXT("Acoustics/Triton/Probes Pending Load"));
+TRACE_DECLARE_INT_COUNTER(Acoustics_TritonProbesLoaded, TEXT("Acoustics/Triton/Probes Loaded"));
+TRACE_DECLARE_INT_COUNTER(Acoustics_TritonProbesLoadFailed, TEXT("Acoustics/Triton/Probe Load Failures"));
+TRACE_DECLARE_INT_COUNTER(Acoustics_TritonFailedQueries, TEXT("Acoustics/Triton/Failed Queries"));
+TRACE_DECLARE_FLOAT_COUNTER(Acoustics_TritonAvgQueryTime, TEXT("Acoustics/Triton/Avg Query Time"));
+TRACE_DECLARE_FLOAT_COUNTER(Acoustics_TritonMaxQueryTime, TEXT("Acoustics/Triton/Max Query Time"));
+TRACE_DECLARE_INT_COUNTER(Acoustics_MaxUpdatesSinceFreshResult, TEXT("Acoustics/Max Ticks Since Fresh Result"));
 
 // Safety margin for ACE streaming loads.
 // When player gets to within this fraction of the loaded region's border,
@@ -34,6 +66,282 @@ static FAutoConsoleVariableRef CVarAcousticsAceTileLoadMargin(
                 TEXT("0 is extremely safe but lots of I/O, 1 is no safety.\n"),
     ECVF_Default);
 
+// Memory map the ACE file instead of reading it through the async file API. Falls back to regular reads when the
+// file can't be mapped, such as when it is inside a PAK file.
+int32 c_MemoryMapAceFile = 0;
+static FAutoConsoleVariableRef CVarAcousticsMemoryMapAceFile(
+    TEXT("PA.MemoryMapAceFile"), c_MemoryMapAceFile,
+    TEXT("Memory map the ACE file and serve probe loads straight from the mapping. Takes effect on the next ACE file ")
+        TEXT("load.\n")
+            TEXT("Only loose files on platforms with memory mapped file support can be mapped, others are read ")
+                TEXT("from disk as usual.\n"),
+    ECVF_Default);
+
+// Read cache for ACE files that aren't memory mapped. Probe loads are served from the most recently read blocks, and
+// blocks are read ahead in the background when the file is read front to back.
+int32 c_AceReadBlockSizeKB = 1024;
+static FAutoConsoleVariableRef CVarAcousticsAceReadBlockSizeKB(
+    TEXT("PA.AceReadBlockSizeKB"), c_AceReadBlockSizeKB,
+    TEXT("Size in KB of each block of the ACE file read cache. Reads this large or larger bypass the cache.\n")
+        TEXT("Takes effect on the next ACE file load.\n"),
+    ECVF_Default);
+
+int32 c_AceReadCacheBlocks = 4;
+static FAutoConsoleVariableRef CVarAcousticsAceReadCacheBlocks(
+    TEXT("PA.AceReadCacheBlocks"), c_AceReadCacheBlocks,
+    TEXT("Number of blocks kept in the ACE file read cache, per file. Blocks are allocated as they are first filled.\n")
+        TEXT("Takes effect on the next ACE file load.\n"),
+    ECVF_Default);
+
+int32 c_AceReadAheadBlocks = 2;
+static FAutoConsoleVariableRef CVarAcousticsAceReadAheadBlocks(
+    TEXT("PA.AceReadAheadBlocks"), c_AceReadAheadBlocks,
+    TEXT("Number of blocks read ahead of a front to back walk through the ACE file. 0 disables reading ahead.\n")
+        TEXT("Takes effect on the next ACE file load.\n"),
+    ECVF_Default);
+
+int32 c_AceMaxReadsInFlight = 4;
+static FAutoConsoleVariableRef CVarAcousticsAceMaxReadsInFlight(
+    TEXT("PA.AceMaxReadsInFlight"), c_AceMaxReadsInFlight,
+    TEXT("Reads from the ACE file larger than a cache block are split into block sized requests, with up to this ")
+        TEXT("many queued at once. 1 reads them in a single request. Takes effect on the next ACE file load.\n"),
+    ECVF_Default);
+
+// Changing the loaded ACE files while others are loaded builds the new Triton instance in the background, so queries
+// keep being answered by the old instance until the new one is swapped in
+int32 c_HotSwapAceFiles = 1;
+static FAutoConsoleVariableRef CVarAcousticsHotSwapAceFiles(
+    TEXT("PA.HotSwapAceFiles"), c_HotSwapAceFiles,
+    TEXT("Load a new set of ACE files, and the probes around the listeners, on a background thread while the current ")
+        TEXT("files keep answering queries, then swap them in.\n")
+            TEXT("0: Clear and reload the files on the game thread, queries fail while they load.\n"),
+    ECVF_Default);
+
+// Triton streams probes in on its own threads, so loads don't wait behind engine work on the global thread pool
+int32 c_NumStreamingThreads = 2;
+static FAutoConsoleVariableRef CVarAcousticsStreamingThreads(
+    TEXT("PA.StreamingThreads"), c_NumStreamingThreads,
+    TEXT("Number of threads that load streamed probes. Each loaded ACE file set streams on one of them at a time, so ")
+        TEXT("more than one helps while a hot-swap loads next to the current files.\n")
+            TEXT("Read when the first ACE file is loaded.\n"),
+    ECVF_Default);
+
+int32 c_StreamingThreadPriority = 1;
+static FAutoConsoleVariableRef CVarAcousticsStreamingThreadPriority(
+    TEXT("PA.StreamingThreadPriority"), c_StreamingThreadPriority,
+    TEXT("Priority of the threads that load streamed probes. 0: Below normal, 1: Normal, 2: Above normal.\n")
+        TEXT("Read when the first ACE file is loaded.\n"),
+    ECVF_Default);
+
+// Paced streaming. A tile that is needed right away still loads in full, see UpdateLoadedRegions.
+int32 c_StreamingSteps = 3;
+static FAutoConsoleVariableRef CVarAcousticsStreamingSteps(
+    TEXT("PA.StreamingSteps"), c_StreamingSteps,
+    TEXT("Number of growing boxes a listener's tile is loaded in, starting at the listener so the nearest probes ")
+        TEXT("arrive first. Each box is requested once the previous one has loaded. 1 loads the whole tile at once.\n"),
+    ECVF_Default);
+
+int32 c_StreamingBandwidthKBps = 0;
+static FAutoConsoleVariableRef CVarAcousticsStreamingBandwidthKBps(
+    TEXT("PA.StreamingBandwidthKBps"), c_StreamingBandwidthKBps,
+    TEXT("Kilobytes per second that probe streaming may read from the ACE files. Loads are held back while reads ")
+        TEXT("are over budget. 0: Unlimited.\n"),
+    ECVF_Default);
+
+int32 c_StreamingMemoryCeilingMB = 0;
+static FAutoConsoleVariableRef CVarAcousticsStreamingMemoryCeilingMB(
+    TEXT("PA.StreamingMemoryCeilingMB"), c_StreamingMemoryCeilingMB,
+    TEXT("Megabytes of Triton memory above which probes the listeners have left behind are unloaded before more are ")
+        TEXT("loaded, and loads are held back once there is nothing left to unload. 0: Unlimited.\n"),
+    ECVF_Default);
+
+int32 c_StreamingMaxProbesPerFrame = 0;
+static FAutoConsoleVariableRef CVarAcousticsStreamingMaxProbesPerFrame(
+    TEXT("PA.StreamingMaxProbesPerFrame"), c_StreamingMaxProbesPerFrame,
+    TEXT("Number of probe loads that may be requested in one frame. A single step of a tile can go over it. ")
+        TEXT("0: Unlimited.\n"),
+    ECVF_Default);
+
+int32 c_TritonMemoryPools = 1;
+static FAutoConsoleVariableRef CVarAcousticsTritonMemoryPools(
+    TEXT("PA.TritonMemoryPools"), c_TritonMemoryPools,
+    TEXT("Serve Triton's small allocations from size-class pools that are kept for reuse. 0: Use the engine ")
+        TEXT("allocator for everything. Read when the module starts up.\n"),
+    ECVF_Default);
+
+int32 c_TritonMemoryBudgetMB = 0;
+static FAutoConsoleVariableRef CVarAcousticsTritonMemoryBudgetMB(
+    TEXT("PA.TritonMemoryBudgetMB"), c_TritonMemoryBudgetMB,
+    TEXT("Hard cap on the megabytes Triton may reserve, pools included. Allocations past it fail, and Triton fails ")
+        TEXT("the loads that needed them. 0: Unlimited.\n"),
+    ECVF_Default);
+
+// Unlike PA.TritonMemoryBudgetMB, which makes allocations fail, this budget is kept by unloading probes
+int32 c_MemoryBudgetMB = 0;
+static FAutoConsoleVariableRef CVarAcousticsMemoryBudgetMB(
+    TEXT("PA.MemoryBudgetMB"), c_MemoryBudgetMB,
+    TEXT("Megabytes of Triton memory to stay under by unloading probes, farthest from the listeners first. Tiles ")
+        TEXT("the listeners left behind go first, then the listeners' tiles are shrunk towards them. 0: Unlimited.\n"),
+    ECVF_Default);
+
+// Each eviction scales the tiles down by this much, never below the minimum
+constexpr float c_EvictionTileScaleStep = 0.8f;
+constexpr float c_MinEvictionTileScale = 0.25f;
+// Below this fraction of the budget, tiles grow back one step at a time for the next time they are loaded
+constexpr float c_EvictionRecoveryFraction = 0.75f;
+constexpr double c_EvictionRecoverySeconds = 2.0;
+// Unloads are queued behind the loads already in flight, so another step waits this long for the last one to land
+constexpr double c_EvictionStepSeconds = 0.25;
+
+// Triton collects its own load and query statistics over windows of this length
+float c_TritonStatsInterval = 1.0f;
+static FAutoConsoleVariableRef CVarAcousticsTritonStatsInterval(
+    TEXT("PA.TritonStatsInterval"), c_TritonStatsInterval,
+    TEXT("Seconds over which Triton's probe streaming and query statistics are collected before they are published ")
+        TEXT("to the stats system, traces and the PA.ShowStats panel. 0 stops collecting them.\n"),
+    ECVF_Default);
+
+constexpr int32 c_MaxStreamingThreads = 8;
+// Matches the engine's thread pool, which streaming used to run on
+constexpr uint32 c_StreamingThreadStackSize = 128 * 1024;
+
+// Number of worker threads used for background acoustic queries.
+// Negative values defer to the project setting.
+int32 c_NumQueryWorkerThreads = -1;
+static FAutoConsoleVariableRef CVarAcousticsQueryWorkerThreads(
+    TEXT("PA.QueryWorkerThreads"), c_NumQueryWorkerThreads,
+    TEXT("Number of worker threads used for background acoustic queries. Takes effect on the next ACE file load.\n")
+        TEXT("-1: Use the project setting, 0: Pick based on core count, >0: Use this many workers.\n"),
+    ECVF_Default);
+
+#if !UE_BUILD_SHIPPING
+// Debug info queries go through the non-const debug interface and are serialized across query workers.
+int32 c_CollectQueryDebugInfo = 1;
+static FAutoConsoleVariableRef CVarAcousticsCollectQueryDebugInfo(
+    TEXT("PA.CollectQueryDebugInfo"), c_CollectQueryDebugInfo,
+    TEXT("Collect per-query debug info for the debug renderer.\n")
+        TEXT("Debug queries run one at a time, so disable this when measuring multi-worker query throughput.\n"),
+    ECVF_Default);
+#endif
+
+constexpr int32 c_MaxQueryWorkerThreads = 16;
+
+// When enabled, background queries are collected over an audio tick and run as one batch at the end of the tick.
+int32 c_BatchQueries = 0;
+static FAutoConsoleVariableRef CVarAcousticsBatchQueries(
+    TEXT("PA.BatchQueries"), c_BatchQueries,
+    TEXT("Collect the background acoustic queries of all sources during an audio tick and run them as one batch.\n")
+        TEXT("0: One background task per source, 1: One batch per audio tick, split across the query workers.\n")
+            TEXT("Requires Unreal Engine 5.1 or later.\n"),
+    ECVF_Default);
+
+// Batches are not split into chunks smaller than this, so small batches don't wake up every query worker
+constexpr int32 c_MinQueryBatchChunkSize = 8;
+
+// Opt-in reuse of query results between nearby sources
+int32 c_EnableQueryCache = 0;
+static FAutoConsoleVariableRef CVarAcousticsQueryCache(
+    TEXT("PA.QueryCache"), c_EnableQueryCache,
+    TEXT("Reuse acoustic query results between sources that are close to each other.\n")
+        TEXT("Sources using dynamic openings or the Push resolver always run their own query.\n"),
+    ECVF_Default);
+
+float c_QueryCacheCellSize = 50.0f;
+static FAutoConsoleVariableRef CVarAcousticsQueryCacheCellSize(
+    TEXT("PA.QueryCacheCellSize"), c_QueryCacheCellSize,
+    TEXT("Size in cm of the cells that source and listener positions are snapped to when looking up cached query ")
+        TEXT("results. Larger cells give more reuse but coarser results.\n"),
+    ECVF_Default);
+
+int32 c_QueryCacheMaxAge = 30;
+static FAutoConsoleVariableRef CVarAcousticsQueryCacheMaxAge(
+    TEXT("PA.QueryCacheMaxAge"), c_QueryCacheMaxAge,
+    TEXT("Number of game ticks a cached query result stays valid. Bounds how long newly streamed probes take to be ")
+        TEXT("picked up.\n"),
+    ECVF_Default);
+
+// Adaptive query scheduling. Sources whose inputs haven't changed much since their last query are refreshed less
+// often, so the query workers spend their time on sources that are actually changing.
+int32 c_AdaptiveQueries = 1;
+static FAutoConsoleVariableRef CVarAcousticsAdaptiveQueries(
+    TEXT("PA.AdaptiveQueries"), c_AdaptiveQueries,
+    TEXT("Skip background queries for sources where neither the source nor the listener moved since the last query.\n")
+        TEXT("0: Query every update, 1: Only query when something moved, or after PA.QueryMaxSkippedUpdates.\n"),
+    ECVF_Default);
+
+float c_QueryMovementThreshold = 10.0f;
+static FAutoConsoleVariableRef CVarAcousticsQueryMovementThreshold(
+    TEXT("PA.QueryMovementThreshold"), c_QueryMovementThreshold,
+    TEXT("Distance in cm the source or listener needs to move since the last query before a new query is run.\n"),
+    ECVF_Default);
+
+int32 c_QueryMaxSkippedUpdates = 8;
+static FAutoConsoleVariableRef CVarAcousticsQueryMaxSkippedUpdates(
+    TEXT("PA.QueryMaxSkippedUpdates"), c_QueryMaxSkippedUpdates,
+    TEXT("Maximum number of updates a source can go without a query, even if nothing moved. This picks up ")
+        TEXT("newly streamed probes and dynamic opening changes.\n"),
+    ECVF_Default);
+
+float c_QueryUrgentMovement = 200.0f;
+static FAutoConsoleVariableRef CVarAcousticsQueryUrgentMovement(
+    TEXT("PA.QueryUrgentMovement"), c_QueryUrgentMovement,
+    TEXT("Distance in cm the source or listener needs to move since the last query for the source to be queried ")
+        TEXT("regardless of the query budget.\n"),
+    ECVF_Default);
+
+int32 c_QueryBudgetPerFrame = 0;
+static FAutoConsoleVariableRef CVarAcousticsQueryBudgetPerFrame(
+    TEXT("PA.QueryBudgetPerFrame"), c_QueryBudgetPerFrame,
+    TEXT("Maximum number of background queries started per frame. Fast moving sources are exempt.\n")
+        TEXT("When limited, the most important sources (loud, close, high Query Priority) are queried first.\n")
+            TEXT("0: Unlimited.\n"),
+    ECVF_Default);
+
+// A new source's first query runs on the audio thread unless a warm-up query already covered it. Bounding how many do
+// that per frame keeps bursts of newly spawned sounds from stalling the audio thread.
+int32 c_SyncQueryBudgetPerFrame = 4;
+static FAutoConsoleVariableRef CVarAcousticsSyncQueryBudgetPerFrame(
+    TEXT("PA.SyncQueryBudgetPerFrame"), c_SyncQueryBudgetPerFrame,
+    TEXT("Maximum number of first queries for new sources run on the audio thread per frame. Sources over the budget ")
+        TEXT("play without acoustics until their first background query completes.\n")
+            TEXT("-1: Unlimited, 0: Never query on the audio thread.\n"),
+    ECVF_Default);
+
+// Number of warm-up queries that can be in flight at once. Sounds played while all of them are busy get no warm-up.
+constexpr int32 c_NumWarmUpQueries = 32;
+
+// Query importance is roughly in dB. Distance attenuation is measured from this distance in cm, and every update a
+// source goes without a query adds c_QueryStalenessImportance, so that quiet sources still get refreshed eventually.
+constexpr float c_QueryImportanceReferenceDistance = 100.0f;
+constexpr float c_QueryStalenessImportance = 1.0f;
+
+// Smooth acoustic parameters between query results, so that less frequent queries don't cause audible steps
+int32 c_TemporalSmoothing = 1;
+static FAutoConsoleVariableRef CVarAcousticsTemporalSmoothing(
+    TEXT("PA.TemporalSmoothing"), c_TemporalSmoothing,
+    TEXT("Ramp each source's acoustic parameters from the previous query result to the latest one, over the time ")
+        TEXT("between the two results.\n"),
+    ECVF_Default);
+
+float c_TemporalSmoothingMaxTime = 0.2f;
+static FAutoConsoleVariableRef CVarAcousticsTemporalSmoothingMaxTime(
+    TEXT("PA.TemporalSmoothingMaxTime"), c_TemporalSmoothingMaxTime,
+    TEXT("Longest time in seconds a ramp between two query results can take. Keeps teleports and sources that ")
+        TEXT("resume after a long pause responsive.\n"),
+    ECVF_Default);
+
+// How long waiting for background work goes before the work that is still outstanding gets logged
+constexpr double c_TaskWaitWarningSeconds = 5.0;
+
+// Layout of FAcousticQuerySlot::State
+constexpr int64 c_QuerySlotReady = 1;
+constexpr int64 c_QuerySlotRegistered = 2;
+constexpr int32 c_QuerySlotGenerationShift = 2;
+
+// Most listeners that outdoorness and streamed tiles are tracked for, enough for four-player split-screen plus
+// spectators
+constexpr int32 c_MaxAcousticListeners = 8;
+
 // Computed outdoorness is 0 only if player is completely enclosed
 // and 1 only when player is standing on a flat plane with no other geometry.
 // These constants bring the range closer to practically observed values.
@@ -49,27 +357,128 @@ constexpr bool c_UseTritonDebugInterface = true;
 constexpr bool c_UseTritonDebugInterface = false;
 #endif
 
+static TritonAcoustics* CreateTritonInstance()
+{
+    return c_UseTritonDebugInterface ? TritonAcousticsDebug::CreateInstance() : TritonAcoustics::CreateInstance();
+}
+
+// Move the slot to a new generation, which invalidates any query that is queued or running for it
+static void AdvanceQuerySlotGeneration(FAcousticQuerySlot& slot, const bool isRegistered)
+{
+    int64 state;
+    int64 newState;
+    do
+    {
+        state = FPlatformAtomics::AtomicRead(&slot.State);
+        newState = (((state >> c_QuerySlotGenerationShift) + 1) << c_QuerySlotGenerationShift) |
+                   (isRegistered ? c_QuerySlotRegistered : 0);
+    } while (FPlatformAtomics::InterlockedCompareExchange(&slot.State, newState, state) != state);
+}
+
+static void LogUnregisteredSource(const uint64_t sourceObjectId)
+{
+    UE_LOG(
+        LogAcousticsRuntime,
+        Error,
+        TEXT("No query slot registered for source:%d. This most likely means this source "
+             "did not register first (RegisterSourceObject) before updating."),
+        sourceObjectId);
+}
+
+// Rotate from one arrival direction towards another. Free field wet parameters have no direction, so zero length
+// vectors are blended linearly instead.
+static ATKVectorF InterpolateDirection(const ATKVectorF& from, const ATKVectorF& to, const float alpha)
+{
+    const FVector fromDirection(from.x, from.y, from.z);
+    const FVector toDirection(to.x, to.y, to.z);
+    const auto fromLength = fromDirection.Size();
+    const auto toLength = toDirection.Size();
+
+    FVector direction;
+    if (fromLength < KINDA_SMALL_NUMBER || toLength < KINDA_SMALL_NUMBER)
+    {
+        direction = FMath::Lerp(fromDirection, toDirection, alpha);
+    }
+    else
+    {
+        const auto rotation =
+            FQuat::Slerp(FQuat::Identity, FQuat::FindBetweenVectors(fromDirection, toDirection), alpha);
+        direction = rotation.RotateVector(fromDirection / fromLength) * FMath::Lerp(fromLength, toLength, alpha);
+    }
+    return ATKVectorF{
+        static_cast<float>(direction.X), static_cast<float>(direction.Y), static_cast<float>(direction.Z)};
+}
+
+// Loudness is blended in dB, which keeps fades perceptually even
+static TritonAcousticParameters InterpolateAcousticParameters(
+    const TritonAcousticParameters& from, const TritonAcousticParameters& to, const float alpha)
+{
+    TritonAcousticParameters result = to;
+    result.Dry.GeomDist = FMath::Lerp(from.Dry.GeomDist, to.Dry.GeomDist, alpha);
+    result.Dry.PathLengthMeters = FMath::Lerp(from.Dry.PathLengthMeters, to.Dry.PathLengthMeters, alpha);
+    result.Dry.LoudnessDb = FMath::Lerp(from.Dry.LoudnessDb, to.Dry.LoudnessDb, alpha);
+    result.Dry.ArrivalDirection = InterpolateDirection(from.Dry.ArrivalDirection, to.Dry.ArrivalDirection, alpha);
+    result.Wet.LoudnessDb = FMath::Lerp(from.Wet.LoudnessDb, to.Wet.LoudnessDb, alpha);
+    result.Wet.ArrivalDirection = InterpolateDirection(from.Wet.ArrivalDirection, to.Wet.ArrivalDirection, alpha);
+    result.Wet.AngularSpreadDegrees = FMath::Lerp(from.Wet.AngularSpreadDegrees, to.Wet.AngularSpreadDegrees, alpha);
+    result.Wet.DecayTimeSeconds = FMath::Lerp(from.Wet.DecayTimeSeconds, to.Wet.DecayTimeSeconds, alpha);
+    return result;
+}
+
+static TritonAcousticParameters EvaluateSmoothing(const FAcousticQuerySlot& slot, const double time)
+{
+    if (slot.SmoothingDuration <= 0.0)
+    {
+        return slot.SmoothingTarget;
+    }
+    const auto alpha =
+        static_cast<float>(FMath::Clamp((time - slot.SmoothingStartTime) / slot.SmoothingDuration, 0.0, 1.0));
+    return InterpolateAcousticParameters(slot.SmoothingStart, slot.SmoothingTarget, alpha);
+}
+
 FProjectAcousticsModule::FProjectAcousticsModule()
     : m_Triton(nullptr)
     , m_AceFileLoaded(false)
-    , m_LastLoadCenterPosition(0, 0, 0)
-    , m_LastLoadTileSize(0, 0, 0)
-    , m_IsOutdoornessStale(true)
-    , m_CachedOutdoorness(0)
+    , m_UnloadProbesOutsideTile(true)
+    , m_TileEvictionScale(1.0f)
+    , m_LastEvictionTime(0.0)
+    , m_TritonStats()
+    , m_HasTritonStats(false)
+    , m_LastTritonStatsTime(0.0)
+    , m_StreamingBandwidthBudget(0.0)
+    , m_LastStreamingUpdateTime(0.0)
+    , m_LastStreamingBytesRead(0)
+    , m_AceCacheScale(1.0f)
     , m_GlobalDesign(FAcousticsDesignParams::Default())
-    , m_NumRunningTasks(0)
+    , m_NumActiveQueryThreadPools(0)
+    , m_StreamingThreadPool(nullptr)
+    , m_QueryBudgetRemaining(0)
+    , m_SyncQueryBudgetRemaining(0)
+    , m_NextWarmUpQuery(0)
+    , m_IsQueryBatchInFlight(false)
+    , m_InFlightQueryBatchCycles(0)
+    , m_MaxUpdatesSinceFreshResult(0)
 {
 #if !UE_BUILD_SHIPPING
     m_IsEnabled = true;
 #endif
-    // Create a threadpool of 1, so that we know that all queries will happen one at a time, from a single thread
-    m_ThreadPool = FQueuedThreadPool::Allocate();
-    m_ThreadPool->Create(1);
+    // Query thread pools are created when the first ACE file is loaded, once project settings are available
+    m_QueryThreadPools.Reserve(c_MaxQueryWorkerThreads);
+    // Until listeners are set, outdoorness is tracked for a single listener
+    m_Listeners.SetNum(1);
+
+    m_WarmUpQueries.SetNum(c_NumWarmUpQueries);
+    for (auto i = 0; i < c_NumWarmUpQueries; i++)
+    {
+        m_WarmUpQueries[i].QueuedWork =
+            MakeUnique<FAcousticsQueuedWork>([this, i]() { ProcessWarmUpQuery(i); }, &m_RunningTasks);
+    }
 }
 
 void FProjectAcousticsModule::StartupModule()
 {
-    m_TritonMemHook = MakeUnique<FTritonMemHook>();
+    m_TritonMemHook = MakeUnique<FTritonMemHook>(c_TritonMemoryPools != 0);
+    m_TritonMemHook->SetBudget(static_cast<int64>(c_TritonMemoryBudgetMB) * 1024 * 1024);
     m_TritonLogHook = MakeUnique<FTritonLogHook>();
     auto initSuccess = TritonAcoustics::Init(m_TritonMemHook.Get(), m_TritonLogHook.Get());
     if (!initSuccess)
@@ -78,7 +487,7 @@ void FProjectAcousticsModule::StartupModule()
         return;
     }
 
-    m_Triton = c_UseTritonDebugInterface ? TritonAcousticsDebug::CreateInstance() : TritonAcoustics::CreateInstance();
+    m_Triton = CreateTritonInstance();
 
     if (!m_Triton)
     {
@@ -103,14 +512,27 @@ void FProjectAcousticsModule::ShutdownModule()
         // Make sure there are no lingering background queries still running
         WaitForRunningTasks();
 
+        // Let instances that were hot-swapped out, or are still loading, finish tearing down
+        CancelAceSwap();
+        for (auto& teardown : m_AceSwapTeardowns)
+        {
+            teardown.Wait();
+        }
+        m_AceSwapTeardowns.Reset();
+
         TritonAcoustics::DestroyInstance(m_Triton);
         TritonAcoustics::TearDown();
         m_Triton = nullptr;
+        // Streaming tasks count down on the task hook, so it goes before the threads they run on
+        m_TritonTaskHook.Reset();
 
 #if !UE_BUILD_SHIPPING
         m_DebugRenderer.Reset();
 #endif
     }
+
+    DestroyQueryThreadPools();
+    DestroyStreamingThreadPool();
 }
 
 bool FProjectAcousticsModule::LoadAceFile(const FString& filePath, const float cacheScale)
@@ -120,36 +542,13 @@ bool FProjectAcousticsModule::LoadAceFile(const FString& filePath, const float c
         return false;
     }
 
-    UnloadAceFile(false);
-
-    auto fullFilePath = FPaths::ProjectDir() + filePath;
-    {
-        SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadAce);
-        // Load the ACE file
-        m_TritonIOHook = MakeUnique<FTritonUnrealIOHook>();
-        if (!m_TritonIOHook->OpenForRead(TCHAR_TO_ANSI(*fullFilePath)))
-        {
-            m_TritonIOHook.Reset();
-
-            UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to open ACE file for reading: [%s]"), *fullFilePath);
-            return false;
-        }
-
-        m_TritonTaskHook = MakeUnique<FTritonAsyncTaskHook>();
-        if (!m_Triton->InitLoad(m_TritonIOHook.Get(), m_TritonTaskHook.Get(), cacheScale))
-        {
-            UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to load ACE file: [%s]"), *fullFilePath);
-            return false;
-        }
-    }
-
-    m_AceFileLoaded = true;
-
-#if !UE_BUILD_SHIPPING
-    m_DebugRenderer->SetLoadedFilename(filePath);
-#endif
-
-    return true;
+    // Replace the previous primary file, keeping any added ones
+    auto aceFiles = GetTargetAceFiles();
+    aceFiles.RemoveAll([](const FAcousticAceFile& file) { return file.IsPrimary; });
+    auto& primaryFile = aceFiles.InsertDefaulted_GetRef(0);
+    primaryFile.FilePath = filePath;
+    primaryFile.IsPrimary = true;
+    return SetAceFiles(MoveTemp(aceFiles), cacheScale, false);
 }
 
 void FProjectAcousticsModule::UnloadAceFile(bool clearOldQueries)
@@ -159,579 +558,2390 @@ void FProjectAcousticsModule::UnloadAceFile(bool clearOldQueries)
         return;
     }
 
-    if (m_AceFileLoaded)
-    {
-        // Make sure there are no lingering background queries still running
-        WaitForRunningTasks();
-        if (clearOldQueries)
-        {
-            m_AcousticQueryResultMap.Reset();
-            m_NumRunningTasks = 0;
-        }
-
-        SCOPE_CYCLE_COUNTER(STAT_Acoustics_ClearAce);
-        m_Triton->Clear();
-        m_AceFileLoaded = false;
-    }
-
-    m_TritonIOHook.Reset();
-}
-
-#if !UE_BUILD_SHIPPING
-
-static TritonAcousticParameters MakeFreefieldParameters(const FVector& sourceLocation, const FVector& listenerLocation)
-{
-
-    auto arrivalDir = AcousticsUtils::UnrealDirectionToTriton(sourceLocation - listenerLocation);
-    auto LOSDist = static_cast<float>(arrivalDir.Size());
-    arrivalDir.Normalize();
-    const float silenceDb = -100.0f;
-    const float zeroDecayTime = 0;
-    DryParams dp = {
-        0,
-        AcousticsUtils::UnrealValToTriton(LOSDist), // PathLength
-        0,                          // Loudness
-        // ArrivalDir
-        {static_cast<float>(arrivalDir.X), static_cast<float>(arrivalDir.Y), static_cast<float>(arrivalDir.Z)}};
-    WetParams wp = {
-        silenceDb, // Loudness
-        // ArrivalDir
-        {
-            0,
-            0,
-            0,
-        },
-        360,          // spread
-        zeroDecayTime // T60
-    };
-    return TritonAcousticParameters{dp, wp};
+    auto aceFiles = GetTargetAceFiles();
+    aceFiles.RemoveAll([](const FAcousticAceFile& file) { return file.IsPrimary; });
+    SetAceFiles(MoveTemp(aceFiles), GetTargetAceCacheScale(), clearOldQueries);
 }
-#endif
 
-bool FProjectAcousticsModule::AddDynamicOpening(
-    class UAcousticsDynamicOpening* opening, const FVector& center, const FVector& normal,
-    const TArray<FVector>& verticesIn)
+bool FProjectAcousticsModule::AddAceFile(const FString& filePath, const float cacheScale)
 {
-    if (!m_Triton || verticesIn.Num() == 0)
+    if (!m_Triton)
     {
         return false;
     }
 
-    TArray<Triton::Vec3f> vertices;
-    for (auto& v : verticesIn)
+    auto aceFiles = GetTargetAceFiles();
+    if (aceFiles.ContainsByPredicate([&filePath](const FAcousticAceFile& file)
+                                     { return !file.IsPrimary && file.FilePath == filePath; }))
     {
-        vertices.Add(AcousticsUtils::ToTritonVector(v));
+        return m_AceFileLoaded || m_PendingAceSwap.IsValid();
     }
 
-    return m_Triton->AddDynamicOpening(
-        reinterpret_cast<uint64_t>(opening),
-        AcousticsUtils::ToTritonVectorDouble(center),
-        AcousticsUtils::ToTritonVector(normal),
-        vertices.Num(),
-        &vertices[0]);
+    auto& addedFile = aceFiles.AddDefaulted_GetRef();
+    addedFile.FilePath = filePath;
+    return SetAceFiles(MoveTemp(aceFiles), cacheScale, false);
 }
 
-bool FProjectAcousticsModule::RemoveDynamicOpening(class UAcousticsDynamicOpening* opening)
+void FProjectAcousticsModule::RemoveAceFile(const FString& filePath)
 {
     if (!m_Triton)
     {
-        return false;
+        return;
     }
 
-    return m_Triton->RemoveDynamicOpening(reinterpret_cast<uint64_t>(opening));
-}
-
-bool FProjectAcousticsModule::UpdateDynamicOpening(
-    class UAcousticsDynamicOpening* opening, float dryAttenuationDb, float wetAttenuationDb)
-{
-    if (!m_Triton)
+    auto aceFiles = GetTargetAceFiles();
+    const auto numRemoved = aceFiles.RemoveAll([&filePath](const FAcousticAceFile& file)
+                                               { return !file.IsPrimary && file.FilePath == filePath; });
+    if (numRemoved == 0)
     {
-        return false;
+        return;
     }
 
-    return m_Triton->UpdateDynamicOpening(reinterpret_cast<uint64_t>(opening), dryAttenuationDb, wetAttenuationDb);
+    SetAceFiles(MoveTemp(aceFiles), GetTargetAceCacheScale(), false);
 }
 
-bool FProjectAcousticsModule::SetGlobalDesign(const FAcousticsDesignParams& params)
+// The files that will be loaded once any hot-swap in flight has completed, without their IO hooks
+TArray<FAcousticAceFile> FProjectAcousticsModule::GetTargetAceFiles() const
 {
-    m_GlobalDesign = params;
-    return true;
+    const auto& aceFiles = m_PendingAceSwap.IsValid() ? m_PendingAceSwap->AceFiles : m_AceFiles;
+    TArray<FAcousticAceFile> targetFiles;
+    targetFiles.Reserve(aceFiles.Num());
+    for (const auto& file : aceFiles)
+    {
+        auto& targetFile = targetFiles.AddDefaulted_GetRef();
+        targetFile.FilePath = file.FilePath;
+        targetFile.IsPrimary = file.IsPrimary;
+    }
+    return targetFiles;
 }
 
-void FProjectAcousticsModule::SetSpaceTransform(const FTransform& newTransform)
+float FProjectAcousticsModule::GetTargetAceCacheScale() const
 {
-    m_SpaceTransform = newTransform;
-    m_InverseSpaceTransform = m_SpaceTransform.Inverse();
+    return m_PendingAceSwap.IsValid() ? m_PendingAceSwap->CacheScale : m_AceCacheScale;
 }
 
-AcousticQueryResults FProjectAcousticsModule::GetAcousticQueryResults(
-    const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
-    AcousticsObjectParams objectParams)
+// Makes aceFiles the loaded set of files, ignoring their IO hooks. While other files are loaded this starts a
+// hot-swap (PA.HotSwapAceFiles), otherwise the files are loaded before returning.
+bool FProjectAcousticsModule::SetAceFiles(
+    TArray<FAcousticAceFile>&& aceFiles, const float cacheScale, const bool clearOldQueries)
 {
-    UpdateOutdoorness(listenerLocation);
-
-    TritonAcousticParameters acousticParams = {};
-    // Need to pass over the state of ApplyDynamicOpenings
-    TritonDynamicOpeningInfo openingInfo = objectParams.DynamicOpeningInfo;
-    InterpolationConfig interpConfig = objectParams.InterpolationConfig;
-    AcousticQueryResults returnStruct = {};
-
-#if !UE_BUILD_SHIPPING
-    TritonRuntime::QueryDebugInfo queryDebugInfo;
+    if (c_HotSwapAceFiles != 0 && m_AceFileLoaded && aceFiles.Num() > 0)
+    {
+        return StartAceSwap(MoveTemp(aceFiles), cacheScale, clearOldQueries);
+    }
 
-    bool querySuccess = GetAcousticParameters(
-        sourceLocation, listenerLocation, acousticParams, openingInfo, interpConfig, &queryDebugInfo);
+    // Loading right away supersedes any hot-swap in flight
+    CancelAceSwap();
+    ClearAceFiles(clearOldQueries);
 
-    returnStruct.QueryDebugInfo = queryDebugInfo;
-#else
-    bool querySuccess =
-        GetAcousticParameters(sourceLocation, listenerLocation, acousticParams, openingInfo, interpConfig);
-#endif // !UE_BUILD_SHIPPING
+    // Files that stay keep their open IO hooks and read caches
+    auto isOpen = true;
+    for (auto& file : aceFiles)
+    {
+        auto loadedFile = m_AceFiles.FindByPredicate(
+            [&file](const FAcousticAceFile& loaded)
+            { return loaded.IsPrimary == file.IsPrimary && loaded.FilePath == file.FilePath; });
+        file.IOHook = loadedFile != nullptr ? MoveTemp(loadedFile->IOHook) : OpenAceFile(file.FilePath);
+        isOpen = isOpen && file.IOHook.IsValid();
+    }
+    aceFiles.RemoveAll([](const FAcousticAceFile& file) { return !file.IOHook.IsValid(); });
 
-    returnStruct.AcousticParams = acousticParams;
-    returnStruct.OpeningInfo = openingInfo;
-    returnStruct.QueryResult = querySuccess;
+    // The instance is cleared, so the IO hooks of files that were dropped can be closed
+    m_AceFiles = MoveTemp(aceFiles);
+    if (m_AceFiles.Num() == 0)
+    {
+        return isOpen;
+    }
 
-    return returnStruct;
+    const auto isLoaded = ReloadAceFiles(cacheScale);
+    return isOpen && isLoaded;
 }
 
-void FProjectAcousticsModule::RegisterSourceObject(const uint64_t sourceObjectId)
+// Clears the Triton instance so that the set of ACE files can change. The IO hooks of the files stay open.
+void FProjectAcousticsModule::ClearAceFiles(const bool clearOldQueries)
 {
-    FScopeLock lock(&m_AcousticQueryResultMapLock);
-
-    // Re-use the old result if it exists. Just don't reset the QueuedWork, because it could still be running
-    AsyncAcousticQueryResults& result = m_AcousticQueryResultMap.FindOrAdd(sourceObjectId);
-
-    if (result.QueuedWork.IsValid())
+    if (m_AceFileLoaded)
     {
-        // There could be an old query running that hasn't finished. Attempt to retract it
-        auto retracted = m_ThreadPool->RetractQueuedWork(result.QueuedWork.Get());
-
-        // If retraction fails, it could be because the task is running. Setting RetractionRequested to true
-        // to indicate to the running task not to store its irrelevant results.
-        result.RetractionRequested = true;
-
-        if (retracted)
+        // Make sure there are no lingering background queries still running
+        WaitForRunningTasks();
+        // The last batch has finished, hand its results back to the sources
+        CollectQueryBatchResults();
+        if (clearOldQueries)
         {
-            // Retracted tasks don't get abandoned. We need to do it.
-            result.QueuedWork->Abandon();
-            result.QueuedWork.Reset();
+            for (const auto& slot : m_QuerySlots)
+            {
+                AdvanceQuerySlotGeneration(*slot, false);
+            }
         }
-    }
 
-    result.QueryResults = TFuture<AcousticQueryResults>();
-    result.HasProcessed = false;
+        SCOPE_CYCLE_COUNTER(STAT_Acoustics_ClearAce);
+        m_Triton->Clear();
+        m_AceFileLoaded = false;
+        m_QueryCache.Reset();
+    }
 }
 
-void FProjectAcousticsModule::UnregisterSourceObject(const uint64_t sourceObjectId)
+TUniquePtr<FTritonUnrealIOHook> FProjectAcousticsModule::OpenAceFile(const FString& filePath) const
 {
-    FScopeLock lock(&m_AcousticQueryResultMapLock);
-
-    if (m_AcousticQueryResultMap.Contains(sourceObjectId))
+    auto fullFilePath = FPaths::ProjectDir() + filePath;
+    auto ioHook = MakeUnique<FTritonUnrealIOHook>(
+        c_MemoryMapAceFile != 0,
+        static_cast<uint64>(FMath::Max(c_AceReadBlockSizeKB, 1)) * 1024,
+        c_AceReadCacheBlocks,
+        c_AceReadAheadBlocks,
+        c_AceMaxReadsInFlight);
+    if (!ioHook->OpenForRead(TCHAR_TO_ANSI(*fullFilePath)))
     {
-        AsyncAcousticQueryResults& queryObject = m_AcousticQueryResultMap[sourceObjectId];
-        if (queryObject.QueuedWork.IsValid())
-        {
-            auto queuedWorkPtr = queryObject.QueuedWork.Get();
+        UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to open ACE file for reading: [%s]"), *fullFilePath);
+        return nullptr;
+    }
+    return ioHook;
+}
 
-            // A query for this source may still be queued. We want to retract it if we can so that it doesn't return
-            // results later. If it was successfully retracted, we can safely remove it from the map. Or, if we know
-            // it's not queued or running, we can remove it. Otherwise, it's possible it's in the running state and we
-            // can't touch it yet. It will eventually be cleaned up during shutdown, where we do wait for tasks to
-            // finish
-            auto retracted = m_ThreadPool->RetractQueuedWork(queuedWorkPtr);
-            auto isQueuedOrRunning = FPlatformAtomics::AtomicRead(&queuedWorkPtr->m_IsQueuedOrRunning);
+// Initializes the cleared Triton instance with all the ACE files in m_AceFiles
+bool FProjectAcousticsModule::ReloadAceFiles(const float cacheScale)
+{
+    m_AceCacheScale = cacheScale;
 
-            // If retraction fails, it could be because the task is running. Setting RetractionRequested to true
-            // to indicate to the running task not to store its irrelevant results.
-            queryObject.RetractionRequested = true;
+    // Pick up any change to the number of query workers
+    RefreshQueryThreadPools();
 
-            if (retracted || (isQueuedOrRunning == 0))
-            {
-                if (retracted)
-                {
-                    // Retracted tasks don't get abandoned. We need to do it.
-                    queuedWorkPtr->Abandon();
-                    queryObject.QueuedWork.Reset();
-                }
-                m_AcousticQueryResultMap.Remove(sourceObjectId);
-            }
-        }
-        else
+    TArray<ITritonIOHook*, TInlineAllocator<8>> ioHooks;
+    FString filePaths;
+    for (const auto& file : m_AceFiles)
+    {
+        // Clearing the instance may have closed the file
+        if (!file.IOHook->IsOpen() &&
+            !file.IOHook->OpenForRead(TCHAR_TO_ANSI(*(FPaths::ProjectDir() + file.FilePath))))
         {
-            m_AcousticQueryResultMap.Remove(sourceObjectId);
+            UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to reopen ACE file for reading: [%s]"), *file.FilePath);
+            continue;
         }
+        ioHooks.Add(file.IOHook.Get());
+        filePaths += filePaths.IsEmpty() ? file.FilePath : TEXT(", ") + file.FilePath;
+    }
+    if (ioHooks.Num() == 0)
+    {
+        return false;
     }
-}
 
-bool FProjectAcousticsModule::UpdateObjectParameters(
-    const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
-    AcousticsObjectParams& objectParams)
-{
-    SCOPE_CYCLE_COUNTER(STAT_Acoustics_UpdateObjectParams);
-
-    if (!m_Triton)
     {
-        return false;
+        SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadAce);
+        // Load the ACE files
+        m_TritonTaskHook = MakeUnique<FTritonAsyncTaskHook>(GetStreamingThreadPool());
+        const auto success =
+            ioHooks.Num() == 1
+                ? m_Triton->InitLoad(ioHooks[0], m_TritonTaskHook.Get(), cacheScale)
+                : m_Triton->InitLoadMultiple(ioHooks.GetData(), ioHooks.Num(), m_TritonTaskHook.Get(), cacheScale);
+        if (!success)
+        {
+            UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to load ACE file: [%s]"), *filePaths);
+            return false;
+        }
     }
 
-    // Validate arguments
-    if (!m_AceFileLoaded)
+    m_AceFileLoaded = true;
+
+    // Clearing the instance dropped the dynamic openings and every loaded probe. Register the openings again, and
+    // stream the probes around the listeners back in so that streaming carries on where it left off.
+    for (const auto& opening : m_DynamicOpenings)
     {
-        return false;
+        AddTritonDynamicOpening(m_Triton, opening.Key, opening.Value);
     }
-    // Get acoustic parameters from Triton. Pass failure on to caller, caller should re-use previous acoustic parameters
-    TritonAcousticParameters acousticParams = {};
-    TritonDynamicOpeningInfo openingInfo = {};
-    TritonRuntime::QueryDebugInfo queryDebugInfo = {};
-
-    // We want to most acoustic queries on a background thread. So for each update call on a source, we will return any
-    // past results and queue up a query to run in the background and be ready for the next call.
-    bool alreadyStoredResult = false;
-    bool querySuccess = false;
-
-    // Need to have a lock on the result map because both background threads and the audio/game thread will be accessing
-    // it
-    m_AcousticQueryResultMapLock.Lock();
-
-    // Check if we have past results for this source
-    if (m_AcousticQueryResultMap.Contains(sourceObjectId))
+    for (const auto& region : m_LoadedRegions)
     {
-        // Have the results been saved?
-        if (m_AcousticQueryResultMap[sourceObjectId].QueryResults.IsReady())
-        {
-            // Results are ready. Get them and use their values
-            auto results = m_AcousticQueryResultMap[sourceObjectId].QueryResults.Get();
-            acousticParams = results.AcousticParams;
-            openingInfo = results.OpeningInfo;
-            querySuccess = results.QueryResult;
-#if !UE_BUILD_SHIPPING
-            queryDebugInfo = results.QueryDebugInfo;
-#endif
-            m_AcousticQueryResultMap[sourceObjectId].QueryResults.Reset();
-        }
-        // This is the first time this source is being processed. Run the first acoustic query call directly on this
-        // calling thread
-        else if (!m_AcousticQueryResultMap[sourceObjectId].HasProcessed)
-        {
-            // We don't want to hold the map lock while we're calling Triton though
-            m_AcousticQueryResultMapLock.Unlock();
+        LoadTritonRegion(m_Triton, region, false, false);
+    }
+    ResetStreamedTiles();
+    RestartTritonStats();
 
-            // Do the query now
-            auto results = GetAcousticQueryResults(sourceObjectId, sourceLocation, listenerLocation, objectParams);
-            // Save the results
-            acousticParams = results.AcousticParams;
-            openingInfo = results.OpeningInfo;
-            querySuccess = results.QueryResult;
 #if !UE_BUILD_SHIPPING
-            queryDebugInfo = results.QueryDebugInfo;
+    m_DebugRenderer->SetLoadedFilename(filePaths);
 #endif
 
-            // Get the map lock back and then store these results in the map, so that the 2nd query will have something
-            // ready. Normal background queries will resume the 2nd time around
-            m_AcousticQueryResultMapLock.Lock();
-            TPromise<AcousticQueryResults> newPromise;
-            newPromise.SetValue(results);
-
-            // Re-use the existing result. Don't reset the QueuedWork, which still could be running.
-            AsyncAcousticQueryResults& result = m_AcousticQueryResultMap.FindOrAdd(sourceObjectId);
-            result.QueryResults = newPromise.GetFuture();
-            result.HasProcessed = true;
+    return true;
+}
 
-            alreadyStoredResult = true;
-        }
-        else
-        {
-            // No results were ready and this is not the first time this source has been processed. This probably means
-            // a background query didn't complete in time.
-            UE_LOG(
-                LogAcousticsRuntime,
-                Warning,
-                TEXT("No acoustic query result found for source:%d. This most likely means a background query "
-                     "did not complete in time."),
-                sourceObjectId);
-        }
+// Loads aceFiles into a new Triton instance on a background thread, while the current instance keeps answering
+// queries. UpdateAceSwap swaps it in once it has loaded.
+bool FProjectAcousticsModule::StartAceSwap(
+    TArray<FAcousticAceFile>&& aceFiles, const float cacheScale, bool clearOldQueries)
+{
+    // The latest request wins over one that is still loading, but still clears the queries the superseded one would
+    // have cleared
+    clearOldQueries = clearOldQueries || (m_PendingAceSwap.IsValid() && m_PendingAceSwap->ClearOldQueries);
+    CancelAceSwap();
+
+    // The current instance keeps reading through the open IO hooks, so the new instance gets its own
+    auto isOpen = true;
+    for (auto& file : aceFiles)
+    {
+        file.IOHook = OpenAceFile(file.FilePath);
+        isOpen = isOpen && file.IOHook.IsValid();
     }
-    else
+    aceFiles.RemoveAll([](const FAcousticAceFile& file) { return !file.IOHook.IsValid(); });
+    if (aceFiles.Num() == 0)
     {
-        UE_LOG(
-            LogAcousticsRuntime,
-            Error,
-            TEXT("No key found in the acoustic query map for source:%d. This most likely means this source "
-                 "did not register first (RegisterSourceObject) before updating."), sourceObjectId);
-        m_AcousticQueryResultMapLock.Unlock();
+        // Nothing to swap in, keep playing with the files that are loaded
         return false;
     }
-    m_AcousticQueryResultMapLock.Unlock();
-
-    // Queue up the query to run on the background thread.
-    // Don't do this if we already stored the results
 
-    if (!alreadyStoredResult)
+    auto swap = MakeUnique<FAcousticAceSwap>();
+    swap->Triton = CreateTritonInstance();
+    if (swap->Triton == nullptr)
+    {
+        UE_LOG(LogAcousticsRuntime, Error, TEXT("Project Acoustics failed to create instance!"));
+        return false;
+    }
+    swap->AceFiles = MoveTemp(aceFiles);
+    swap->TaskHook = MakeUnique<FTritonAsyncTaskHook>(GetStreamingThreadPool());
+    swap->CacheScale = cacheScale;
+    swap->ClearOldQueries = clearOldQueries;
+
+    // Stream in the tiles around the listeners before the swap, so the new instance can answer queries right away.
+    // The space transform belongs to the game thread, so the tiles are converted here.
+    TArray<TPair<Triton::Vec3d, Triton::Vec3d>> regions;
+    for (const auto& region : m_LoadedRegions)
     {
-        // Function to perform an acoustic query on a separate thread and save the result to the local map
-        TFunction<void()> RunBackgroundAcousticsQuery(
-            [this, sourceObjectId, sourceLocation, listenerLocation, objectParams]()
+        if (!region.Size.IsZero())
+        {
+            regions.Emplace(
+                AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(region.Center)),
+                AcousticsUtils::ToTritonVectorDouble(WorldScaleToTriton(region.Size).GetAbs()));
+        }
+    }
+
+    // The swap is only torn down once this has finished, so it can be used from the loading thread
+    auto swapPtr = swap.Get();
+    swap->LoadResult = Async(
+        EAsyncExecution::Thread,
+        [swapPtr, regions = MoveTemp(regions)]()
+        {
+            TArray<ITritonIOHook*, TInlineAllocator<8>> ioHooks;
+            for (const auto& file : swapPtr->AceFiles)
             {
-                // Run the acoustic query
-                auto results = GetAcousticQueryResults(
-                    sourceObjectId,
-                    sourceLocation,
-                    listenerLocation,
-                    objectParams);
-
-                FScopeLock lock(&m_AcousticQueryResultMapLock);
-                if (m_AcousticQueryResultMap.Contains(sourceObjectId))
-                {
-                    AsyncAcousticQueryResults& result = m_AcousticQueryResultMap[sourceObjectId];
-                    if (result.RetractionRequested)
-                    {
-                        // This task was attempted to be retracted but wasn't able to be. We don't want to store
-                        // these results. Exit early.
-                        result.RetractionRequested = false;
-                        return;
-                    }
+                ioHooks.Add(file.IOHook.Get());
+            }
 
-                    // Store the promise/future in the map for retrieval on the next update pass
-                    TPromise<AcousticQueryResults> newPromise;
-                    newPromise.SetValue(results);
+            SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadAce);
+            auto triton = swapPtr->Triton;
+            const auto success =
+                ioHooks.Num() == 1
+                    ? triton->InitLoad(ioHooks[0], swapPtr->TaskHook.Get(), swapPtr->CacheScale)
+                    : triton->InitLoadMultiple(
+                          ioHooks.GetData(), ioHooks.Num(), swapPtr->TaskHook.Get(), swapPtr->CacheScale);
+            if (!success)
+            {
+                return false;
+            }
 
-                    result.HasProcessed = true;
-                    result.QueryResults = newPromise.GetFuture();
-                }
-            });
+            for (const auto& region : regions)
+            {
+                triton->LoadRegion(region.Key, region.Value, false, true);
+            }
+            return true;
+        });
 
-        m_AcousticQueryResultMapLock.Lock();
-        AsyncAcousticQueryResults& result = m_AcousticQueryResultMap.FindOrAdd(sourceObjectId);
+    m_PendingAceSwap = MoveTemp(swap);
+    return isOpen;
+}
 
-        // If the last query is still running, we don't want to schedule a new one and fall behind. Skip the
-        // scheduling, and try again next pass.
-        auto queryStillRunning =
-            result.QueuedWork.IsValid() ? FPlatformAtomics::AtomicRead(&result.QueuedWork->m_IsQueuedOrRunning) : 0;
-        if (!queryStillRunning)
-        {
-            // Queue up the acoustic query
-            result.RetractionRequested = false;
+// Swaps in the hot-swapped instance once it has finished loading. Game thread only.
+void FProjectAcousticsModule::UpdateAceSwap()
+{
+    m_AceSwapTeardowns.RemoveAll([](const TFuture<void>& teardown) { return teardown.IsReady(); });
 
-            // Save the QueuedWork item in case we want to retract it later
-            result.QueuedWork = TUniquePtr<FAcousticsQueuedWork>(
-                new FAcousticsQueuedWork(MoveTemp(RunBackgroundAcousticsQuery), &m_NumRunningTasks));
+    if (!m_PendingAceSwap.IsValid() || !m_PendingAceSwap->LoadResult.IsReady())
+    {
+        return;
+    }
 
-            // Signal that we've queued this item
-            result.QueuedWork->SignalStart();
+    auto swap = MoveTemp(m_PendingAceSwap);
+    FString filePaths;
+    for (const auto& file : swap->AceFiles)
+    {
+        filePaths += filePaths.IsEmpty() ? file.FilePath : TEXT(", ") + file.FilePath;
+    }
+    if (!swap->LoadResult.Get())
+    {
+        // The files that are loaded stay in use
+        UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to load ACE file: [%s]"), *filePaths);
+        RetireAceSwap(MoveTemp(swap));
+        return;
+    }
 
-            // Add our query to the queue
-            m_ThreadPool->AddQueuedWork(result.QueuedWork.Get());
-        }
-        m_AcousticQueryResultMapLock.Unlock();
+    // Catch the new instance up before it goes live. The listeners may have moved on to other tiles while it loaded,
+    // and probes it already has cost no IO.
+    for (const auto& opening : m_DynamicOpenings)
+    {
+        AddTritonDynamicOpening(swap->Triton, opening.Key, opening.Value);
+    }
+    for (const auto& region : m_LoadedRegions)
+    {
+        LoadTritonRegion(swap->Triton, region, false, false);
     }
 
-#if !UE_BUILD_SHIPPING
-    if (!querySuccess)
     {
-        // Even if query fails, we want to catch that debug information before exiting this function
-        m_DebugRenderer->UpdateSourceAcoustics(
-            sourceObjectId, sourceLocation, listenerLocation, querySuccess, objectParams, queryDebugInfo);
-        int  NumMessages;
-        const TritonRuntime::QueryDebugInfo::DebugMessage* Messages = queryDebugInfo.GetMessageList(NumMessages);
-        UE_LOG(LogAcousticsRuntime, Verbose, TEXT("%s : Query for ObjID[%llu] at [%.2f, %.2f, %.2f] failed with %d messages:"),
-            ANSI_TO_TCHAR(__FUNCTION__),
-            sourceObjectId,
-            sourceLocation.X,
-            sourceLocation.Y,
-            sourceLocation.Z,
-            NumMessages);
-        for (int i=0; i<NumMessages; i++)
-        {
-            UE_LOGFMT(LogAcousticsRuntime, Verbose, "  {0}", Messages[i].MessageString);
-        }
-        return false;
+        // Waits for the queries that are running on the old instance
+        FWriteScopeLock lock(m_TritonLock);
+        Swap(m_Triton, swap->Triton);
     }
-#else
-    if (!querySuccess)
+    if (swap->ClearOldQueries)
     {
-        return false;
+        // Drop the old queries, as clearing the files would have. Queries still running against the old instance
+        // then carry a stale generation and never publish their results.
+        for (const auto& slot : m_QuerySlots)
+        {
+            AdvanceQuerySlotGeneration(*slot, false);
+        }
     }
-#endif // !UE_BUILD_SHIPPING
+    Swap(m_AceFiles, swap->AceFiles);
+    Swap(m_TritonTaskHook, swap->TaskHook);
+    m_AceCacheScale = swap->CacheScale;
+    m_QueryCache.Reset();
+    // Pick up any change to the number of query workers, as reloading the files would have
+    RefreshQueryThreadPools();
+    // The new instance loaded the whole tiles, and has nothing stale
+    ResetStreamedTiles();
+    RestartTritonStats();
 
-    // Caller passes in design adjustments for this emitter,
-    // update them with global adjustments
-    FAcousticsDesignParams::Combine(objectParams.Design, m_GlobalDesign);
+#if !UE_BUILD_SHIPPING
+    m_DebugRenderer->SetLoadedFilename(filePaths);
+#endif
 
-    // Set the remaining fields apart from design
-    objectParams.ObjectId = sourceObjectId;
-    objectParams.TritonParams = acousticParams;
-    objectParams.DynamicOpeningInfo = openingInfo;
-    // Outdoorness value is shared across all emitters since it depends only on
-    // listener location (for now), fill in that shared value.
-    objectParams.Outdoorness = m_CachedOutdoorness;
+    // The swap now carries the old instance
+    RetireAceSwap(MoveTemp(swap));
+}
 
-#if !UE_BUILD_SHIPPING
-    // If acoustics is disabled, intercept parameters headed to DSP
-    // and substitute "no acoustics" in all parameters - i.e. how it
-    // would sound if there were no geometry in the scene. Note that
-    // the system's internal logic such as doing queries, updating streaming
-    // etc. still remain active. This is intentional since the intended use
-    // case is for someone to do a quick A/B by toggling switch to hear difference
-    // such as for debugging.
-    if (!m_IsEnabled)
+void FProjectAcousticsModule::CancelAceSwap()
+{
+    if (m_PendingAceSwap.IsValid())
     {
-        objectParams.TritonParams = MakeFreefieldParameters(sourceLocation, listenerLocation);
-        objectParams.Outdoorness = 1;
+        RetireAceSwap(MoveTemp(m_PendingAceSwap));
     }
+}
 
-    // Catch debug information for this source
-    m_DebugRenderer->UpdateSourceAcoustics(
-        sourceObjectId, sourceLocation, listenerLocation, querySuccess, objectParams, queryDebugInfo);
-#endif
+// Tears down the instance carried by the swap on a background thread. Clearing it waits for its streaming tasks, and
+// its IO hooks and task hook are released only after it is gone.
+void FProjectAcousticsModule::RetireAceSwap(TUniquePtr<FAcousticAceSwap>&& swap)
+{
+    m_AceSwapTeardowns.Add(Async(
+        EAsyncExecution::Thread,
+        [swap = MoveTemp(swap)]() mutable
+        {
+            // An instance that was superseded while loading has to finish loading first
+            if (swap->LoadResult.IsValid())
+            {
+                swap->LoadResult.Wait();
+            }
+            if (swap->Triton != nullptr)
+            {
+                SCOPE_CYCLE_COUNTER(STAT_Acoustics_ClearAce);
+                swap->Triton->Clear();
+                TritonAcoustics::DestroyInstance(swap->Triton);
+            }
+            swap.Reset();
+        }));
+}
 
-    return true;
+#if !UE_BUILD_SHIPPING
+
+static TritonAcousticParameters MakeFreefieldParameters(const FVector& sourceLocation, const FVector& listenerLocation)
+{
+
+    auto arrivalDir = AcousticsUtils::UnrealDirectionToTriton(sourceLocation - listenerLocation);
+    auto LOSDist = static_cast<float>(arrivalDir.Size());
+    arrivalDir.Normalize();
+    const float silenceDb = -100.0f;
+    const float zeroDecayTime = 0;
+    DryParams dp = {
+        0,
+        AcousticsUtils::UnrealValToTriton(LOSDist), // PathLength
+        0,                          // Loudness
+        // ArrivalDir
+        {static_cast<float>(arrivalDir.X), static_cast<float>(arrivalDir.Y), static_cast<float>(arrivalDir.Z)}};
+    WetParams wp = {
+        silenceDb, // Loudness
+        // ArrivalDir
+        {
+            0,
+            0,
+            0,
+        },
+        360,          // spread
+        zeroDecayTime // T60
+    };
+    return TritonAcousticParameters{dp, wp};
 }
+#endif
 
-bool FProjectAcousticsModule::PostTick()
+bool FProjectAcousticsModule::AddDynamicOpening(
+    class UAcousticsDynamicOpening* opening, const FVector& center, const FVector& normal,
+    const TArray<FVector>& verticesIn)
 {
-    if (!m_Triton)
+    if (!m_Triton || verticesIn.Num() == 0)
     {
         return false;
     }
 
-    m_IsOutdoornessStale = true;
-    return true;
+    // Remember the opening, so that it is registered again whenever the ACE files are reloaded
+    auto& dynamicOpening = m_DynamicOpenings.Add(reinterpret_cast<uint64>(opening));
+    dynamicOpening.Center = center;
+    dynamicOpening.Normal = normal;
+    for (auto& v : verticesIn)
+    {
+        dynamicOpening.Vertices.Add(AcousticsUtils::ToTritonVector(v));
+    }
+
+    return AddTritonDynamicOpening(m_Triton, reinterpret_cast<uint64>(opening), dynamicOpening);
 }
 
-bool FProjectAcousticsModule::UpdateDistances(const FVector& listenerLocation)
+bool FProjectAcousticsModule::AddTritonDynamicOpening(
+    TritonAcoustics* triton, const uint64 openingId, const FAcousticDynamicOpening& opening)
 {
-    if (!m_Triton)
+    auto success = triton->AddDynamicOpening(
+        openingId,
+        AcousticsUtils::ToTritonVectorDouble(opening.Center),
+        AcousticsUtils::ToTritonVector(opening.Normal),
+        opening.Vertices.Num(),
+        opening.Vertices.GetData());
+    if (success && opening.HasAttenuation)
     {
-        return false;
+        success = triton->UpdateDynamicOpening(openingId, opening.DryAttenuationDb, opening.WetAttenuationDb);
     }
-
-    auto listener = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(listenerLocation));
-    return m_Triton->UpdateDistancesForListener(listener);
+    return success;
 }
 
-bool FProjectAcousticsModule::QueryDistance(const FVector& lookDirection, float& outDistance)
+bool FProjectAcousticsModule::RemoveDynamicOpening(class UAcousticsDynamicOpening* opening)
 {
     if (!m_Triton)
     {
-        outDistance = 0;
         return false;
     }
 
-    auto dir = AcousticsUtils::ToTritonVector(WorldDirectionToTriton(lookDirection));
-    outDistance = m_Triton->QueryDistanceForListener(dir) * AcousticsUtils::c_TritonToUnrealScale;
-    return true;
+    m_DynamicOpenings.Remove(reinterpret_cast<uint64>(opening));
+    return m_Triton->RemoveDynamicOpening(reinterpret_cast<uint64_t>(opening));
 }
 
-bool FProjectAcousticsModule::UpdateOutdoorness(const FVector& listenerLocation)
+bool FProjectAcousticsModule::UpdateDynamicOpening(
+    class UAcousticsDynamicOpening* opening, float dryAttenuationDb, float wetAttenuationDb)
 {
     if (!m_Triton)
     {
         return false;
     }
 
-    // This function will be called by each sound source in a frame.
-    // Since outdoorness depends only on player location, we do work
-    // only once per frame, regardless of whether query succeeds or fails.
-    // In case of failure, we leave the old cached outdoorness value unmodified.
-    if (m_IsOutdoornessStale)
+    auto dynamicOpening = m_DynamicOpenings.Find(reinterpret_cast<uint64>(opening));
+    if (dynamicOpening != nullptr)
     {
-        auto listener = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(listenerLocation));
-        bool success = false;
-        {
-            SCOPE_CYCLE_COUNTER(STAT_Acoustics_QueryOutdoorness);
-            auto outdoorness = 0.0f;
-            success = m_Triton->GetOutdoornessAtListener(listener, outdoorness);
-            if (success)
-            {
-                const float NormalizedVal =
-                    (outdoorness - c_OutdoornessIndoors) / (c_OutdoornessOutdoors - c_OutdoornessIndoors);
-                m_CachedOutdoorness = FMath::Clamp(NormalizedVal, 0.0f, 1.0f);
-            }
-        }
-
-        m_IsOutdoornessStale = false;
-        return success;
+        dynamicOpening->HasAttenuation = true;
+        dynamicOpening->DryAttenuationDb = dryAttenuationDb;
+        dynamicOpening->WetAttenuationDb = wetAttenuationDb;
     }
 
-    return true;
+    return m_Triton->UpdateDynamicOpening(reinterpret_cast<uint64_t>(opening), dryAttenuationDb, wetAttenuationDb);
 }
 
-inline float FProjectAcousticsModule::GetOutdoorness() const
+void FProjectAcousticsModule::AddRuntimeVolume(
+    class AAcousticsRuntimeVolume* volume, const uint32 worldId, const FBox& bounds,
+    const TArray<TArray<FPlane>>& hulls, const FAcousticsDesignParams& overrideParams)
 {
-    return m_CachedOutdoorness;
+    m_RuntimeVolumeIndex.Add(reinterpret_cast<uint64>(volume), worldId, bounds, hulls, overrideParams);
 }
 
-bool FProjectAcousticsModule::CalculateReverbSendWeights(
-    const float targetReverbTime, const uint32_t numReverbs, const float* reverbTimes, float* reverbSendWeights) const
+bool FProjectAcousticsModule::RemoveRuntimeVolume(class AAcousticsRuntimeVolume* volume)
 {
-    return TritonAcoustics::CalculateReverbSendWeights(targetReverbTime, numReverbs, reverbTimes, reverbSendWeights);
+    return m_RuntimeVolumeIndex.Remove(reinterpret_cast<uint64>(volume));
 }
 
+bool FProjectAcousticsModule::UpdateRuntimeVolume(
+    class AAcousticsRuntimeVolume* volume, const FAcousticsDesignParams& overrideParams)
+{
+    return m_RuntimeVolumeIndex.UpdateDesignParams(reinterpret_cast<uint64>(volume), overrideParams);
+}
 
-bool FProjectAcousticsModule::GetAcousticParameters(
-    const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& params,
-    TritonDynamicOpeningInfo& outOpeningInfo, const InterpolationConfig& interpConfig, TritonRuntime::QueryDebugInfo* outDebugInfo /* = nullptr */)
+void FProjectAcousticsModule::ApplyRuntimeVolumeOverrides(
+    const uint32 worldId, const FVector& location, FAcousticsDesignParams& designParams) const
 {
-    auto source = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(sourceLocation));
-    auto listener = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(listenerLocation));
+    m_RuntimeVolumeIndex.ApplyOverrides(worldId, location, designParams);
+}
 
-    bool acousticParamsValid = false;
-    {
-        SCOPE_CYCLE_COUNTER(STAT_Acoustics_Query);
+bool FProjectAcousticsModule::SetGlobalDesign(const FAcousticsDesignParams& params)
+{
+    m_GlobalDesign = params;
+    return true;
+}
 
-#if !UE_BUILD_SHIPPING
-        acousticParamsValid = GetTritonDebugInstance()->QueryAcoustics(
-            source, listener, params, outOpeningInfo, &interpConfig, outDebugInfo);
-#else
-        acousticParamsValid = m_Triton->QueryAcoustics(source, listener, params, outOpeningInfo, &interpConfig);
-#endif
-    }
+void FProjectAcousticsModule::SetSpaceTransform(const FTransform& newTransform)
+{
+    m_SpaceTransform = newTransform;
+    m_InverseSpaceTransform = m_SpaceTransform.Inverse();
 
+    // Cached results are keyed on world positions
+    m_QueryCache.Reset();
+}
 
-    return acousticParamsValid;
+AcousticQueryResults FProjectAcousticsModule::GetAcousticQueryResults(
+    const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
+    AcousticsObjectParams objectParams)
+{
+    UpdateOutdoorness(listenerLocation);
+
+    // Need to pass over the state of ApplyDynamicOpenings
+    return RunAcousticQuery(
+        sourceLocation, listenerLocation, objectParams.DynamicOpeningInfo, objectParams.InterpolationConfig);
 }
 
-// Wait for any remaining background queries to finish
-void FProjectAcousticsModule::WaitForRunningTasks()
+AcousticQueryResults FProjectAcousticsModule::RunAcousticQuery(
+    const FVector& sourceLocation, const FVector& listenerLocation, const TritonDynamicOpeningInfo& inOpeningInfo,
+    const InterpolationConfig& interpConfig)
 {
-    while (m_NumRunningTasks > 0)
+    TritonAcousticParameters acousticParams = {};
+    TritonDynamicOpeningInfo openingInfo = inOpeningInfo;
+    AcousticQueryResults returnStruct = {};
+
+    // Dynamic openings and the push vector make results depend on more than the two locations, so those queries
+    // are never shared
+    const bool useCache = c_EnableQueryCache != 0 && !inOpeningInfo.ApplyDynamicOpening &&
+                          interpConfig.Resolver != InterpolationConfig::DisambiguationMode::Push;
+    FAcousticsQueryCache::FKey cacheKey = {};
+    // A hot-swap or reload can reset the cache while the query runs against the previous data
+    const auto cacheGeneration = m_QueryCache.GetGeneration();
+    if (useCache)
     {
-        FPlatformProcess::Sleep(0);
+        cacheKey = FAcousticsQueryCache::MakeKey(
+            sourceLocation, listenerLocation, static_cast<uint8>(interpConfig.Resolver), c_QueryCacheCellSize);
+        if (m_QueryCache.Find(cacheKey, static_cast<uint32>(FMath::Max(c_QueryCacheMaxAge, 0)), acousticParams))
+        {
+            returnStruct.AcousticParams = acousticParams;
+            returnStruct.OpeningInfo = openingInfo;
+            returnStruct.QueryResult = true;
+            return returnStruct;
+        }
     }
-}
+
+#if !UE_BUILD_SHIPPING
+    TritonRuntime::QueryDebugInfo queryDebugInfo;
+
+    bool querySuccess = GetAcousticParameters(
+        sourceLocation,
+        listenerLocation,
+        acousticParams,
+        openingInfo,
+        interpConfig,
+        c_CollectQueryDebugInfo != 0 ? &queryDebugInfo : nullptr);
+
+    returnStruct.QueryDebugInfo = queryDebugInfo;
+#else
+    bool querySuccess =
+        GetAcousticParameters(sourceLocation, listenerLocation, acousticParams, openingInfo, interpConfig);
+#endif // !UE_BUILD_SHIPPING
+
+    // Failed queries aren't cached, they may well succeed once more probes have streamed in
+    if (useCache && querySuccess)
+    {
+        m_QueryCache.Add(cacheKey, acousticParams, cacheGeneration);
+    }
+
+    returnStruct.AcousticParams = acousticParams;
+    returnStruct.OpeningInfo = openingInfo;
+    returnStruct.QueryResult = querySuccess;
+
+    return returnStruct;
+}
+
+void FProjectAcousticsModule::SetMaxSources(const int32 maxSources)
+{
+    // Slots are only ever added. Existing slots stay where they are since queued work points at them.
+    m_QuerySlots.Reserve(maxSources);
+    while (m_QuerySlots.Num() < maxSources)
+    {
+        auto slot = MakeUnique<FAcousticQuerySlot>();
+        auto slotPtr = slot.Get();
+        slot->SourceObjectId = m_QuerySlots.Num();
+        slot->QueuedWork =
+            MakeUnique<FAcousticsQueuedWork>([this, slotPtr]() { ProcessSlotQuery(*slotPtr); }, &m_RunningTasks);
+        m_QuerySlots.Add(MoveTemp(slot));
+    }
+}
+
+void FProjectAcousticsModule::RegisterSourceObject(const uint64_t sourceObjectId)
+{
+    auto slot = FindQuerySlot(sourceObjectId);
+    if (slot == nullptr)
+    {
+        UE_LOG(
+            LogAcousticsRuntime,
+            Error,
+            TEXT("Source:%d is outside of the %d preallocated query slots. Make sure SetMaxSources is called with the "
+                 "audio mixer's source count."),
+            sourceObjectId,
+            m_QuerySlots.Num());
+        return;
+    }
+
+    // Claim the slot for the new source. A query that is still running for the previous source won't be able to
+    // publish its results.
+    AdvanceQuerySlotGeneration(*slot, true);
+    slot->HasProcessed = false;
+    slot->IsFirstQueryPending = false;
+    slot->HasLastResults = false;
+    slot->HasSmoothingTarget = false;
+    slot->UpdatesSinceQuery = 0;
+    slot->UpdatesSinceFreshResult = 0;
+}
+
+void FProjectAcousticsModule::UnregisterSourceObject(const uint64_t sourceObjectId)
+{
+    // A query for this source may still be queued or running. It will notice the generation change and discard its
+    // results, so the slot can be reused right away.
+    auto slot = FindQuerySlot(sourceObjectId);
+    if (slot != nullptr)
+    {
+        AdvanceQuerySlotGeneration(*slot, false);
+    }
+}
+
+void FProjectAcousticsModule::WarmUpQuery(
+    const FVector& sourceLocation, const FVector& listenerLocation, const AcousticsObjectParams& objectParams)
+{
+    // Warm-up results are shared through the query cache, which doesn't hold results that depend on more than the two
+    // locations
+    if (!m_Triton || !m_AceFileLoaded || objectParams.ApplyDynamicOpenings ||
+        objectParams.InterpolationConfig.Resolver == InterpolationConfig::DisambiguationMode::Push)
+    {
+        return;
+    }
+
+    StartWarmUpQuery(sourceLocation, listenerLocation, objectParams.InterpolationConfig);
+}
+
+// Hands the query to the first idle warm-up query from m_NextWarmUpQuery on. Called from the game thread when a sound
+// is played, and from the audio thread for first queries. Returns false if all warm-up queries are busy.
+bool FProjectAcousticsModule::StartWarmUpQuery(
+    const FVector& sourceLocation, const FVector& listenerLocation, const InterpolationConfig& interpolationConfig)
+{
+    const auto first = FPlatformAtomics::AtomicRead(&m_NextWarmUpQuery);
+    for (auto i = 0; i < c_NumWarmUpQueries; i++)
+    {
+        const auto warmUpIndex = (first + i) % c_NumWarmUpQueries;
+        auto queryThreadPool = GetQueryThreadPool(warmUpIndex);
+        if (queryThreadPool == nullptr)
+        {
+            return false;
+        }
+
+        // Claiming the work item makes its inputs ours until it has run
+        auto& warmUp = m_WarmUpQueries[warmUpIndex];
+        if (!warmUp.QueuedWork->TrySignalStart())
+        {
+            continue;
+        }
+        FPlatformAtomics::AtomicStore(&m_NextWarmUpQuery, (warmUpIndex + 1) % c_NumWarmUpQueries);
+
+        warmUp.SourceLocation = sourceLocation;
+        warmUp.ListenerLocation = listenerLocation;
+        warmUp.InterpolationConfig = interpolationConfig;
+
+        INC_DWORD_STAT(STAT_Acoustics_WarmUpQueries);
+        // The sound starts playing within a frame or two, so get ahead of the regular background queries
+        queryThreadPool->AddQueuedWork(warmUp.QueuedWork.Get(), EQueuedWorkPriority::High);
+        return true;
+    }
+
+    // All warm-up queries are busy. The first query falls back to the sync budget or the source's own query.
+    return false;
+}
+
+// Runs on a query worker
+void FProjectAcousticsModule::ProcessWarmUpQuery(const int32 warmUpIndex)
+{
+    const auto& warmUp = m_WarmUpQueries[warmUpIndex];
+    const auto cacheKey = FAcousticsQueryCache::MakeKey(
+        warmUp.SourceLocation,
+        warmUp.ListenerLocation,
+        static_cast<uint8>(warmUp.InterpolationConfig.Resolver),
+        c_QueryCacheCellSize);
+
+    TritonAcousticParameters acousticParams = {};
+    TritonDynamicOpeningInfo openingInfo = {};
+    const auto cacheGeneration = m_QueryCache.GetGeneration();
+    if (GetAcousticParameters(
+            warmUp.SourceLocation, warmUp.ListenerLocation, acousticParams, openingInfo, warmUp.InterpolationConfig))
+    {
+        m_QueryCache.Add(cacheKey, acousticParams, cacheGeneration);
+    }
+}
+
+// Results for the first update of a source, without blocking the audio thread on a query where possible. Returns
+// false if the source has to wait for a background query.
+bool FProjectAcousticsModule::GetFirstQueryResults(
+    FAcousticQuerySlot& slot, const FVector& sourceLocation, const FVector& listenerLocation,
+    const AcousticsObjectParams& objectParams, AcousticQueryResults& outResults)
+{
+    // Use the warm-up query that was started when the sound was played, if it has finished
+    const auto canWarmUp = !objectParams.DynamicOpeningInfo.ApplyDynamicOpening &&
+                           objectParams.InterpolationConfig.Resolver != InterpolationConfig::DisambiguationMode::Push;
+    if (canWarmUp)
+    {
+        const auto cacheKey = FAcousticsQueryCache::MakeKey(
+            sourceLocation,
+            listenerLocation,
+            static_cast<uint8>(objectParams.InterpolationConfig.Resolver),
+            c_QueryCacheCellSize);
+        if (m_QueryCache.Find(
+                cacheKey, static_cast<uint32>(FMath::Max(c_QueryCacheMaxAge, 0)), outResults.AcousticParams))
+        {
+            INC_DWORD_STAT(STAT_Acoustics_FirstQueryCacheHits);
+            outResults.OpeningInfo = objectParams.DynamicOpeningInfo;
+            outResults.QueryResult = true;
+            return true;
+        }
+        // Counted once per source, not again while it waits for its background query. A miss means there was no
+        // warm-up, it hadn't finished, or the listener or source moved to another cell since it started.
+        if (!slot.IsFirstQueryPending)
+        {
+            INC_DWORD_STAT(STAT_Acoustics_FirstQueryCacheMisses);
+        }
+    }
+
+    // A background query is already on its way, don't run the same query here as well
+    if (slot.IsFirstQueryPending)
+    {
+        return false;
+    }
+
+    if (c_SyncQueryBudgetPerFrame >= 0 && FPlatformAtomics::InterlockedDecrement(&m_SyncQueryBudgetRemaining) < 0)
+    {
+        // Sounds that weren't warmed up when they were played (only UAcousticsAudioComponent does that) get their
+        // warm-up now, so their result doesn't wait behind the regular background queries on their worker. The
+        // source's own background query still runs in case it moves to another cache cell.
+        if (canWarmUp)
+        {
+            StartWarmUpQuery(sourceLocation, listenerLocation, objectParams.InterpolationConfig);
+        }
+        return false;
+    }
+
+    INC_DWORD_STAT(STAT_Acoustics_SyncFirstQueries);
+    outResults = GetAcousticQueryResults(slot.SourceObjectId, sourceLocation, listenerLocation, objectParams);
+    return true;
+}
+
+bool FProjectAcousticsModule::UpdateObjectParameters(
+    const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
+    AcousticsObjectParams& objectParams)
+{
+    SCOPE_CYCLE_COUNTER(STAT_Acoustics_UpdateObjectParams);
+
+    if (!m_Triton)
+    {
+        return false;
+    }
+
+    // Validate arguments
+    if (!m_AceFileLoaded)
+    {
+        return false;
+    }
+    // Get acoustic parameters from Triton. Pass failure on to caller, caller should re-use previous acoustic parameters
+    AcousticQueryResults results = {};
+    const bool useBatch = c_BatchQueries != 0;
+    const bool isRegistered =
+        useBatch ? UpdateBatchedQuery(sourceObjectId, sourceLocation, listenerLocation, objectParams, results)
+                 : UpdatePerSourceQuery(sourceObjectId, sourceLocation, listenerLocation, objectParams, results);
+    if (!isRegistered)
+    {
+        return false;
+    }
+
+    const TritonAcousticParameters& acousticParams = results.AcousticParams;
+    const TritonDynamicOpeningInfo& openingInfo = results.OpeningInfo;
+    const bool querySuccess = results.QueryResult;
+#if !UE_BUILD_SHIPPING
+    const TritonRuntime::QueryDebugInfo& queryDebugInfo = results.QueryDebugInfo;
+#endif
+
+#if !UE_BUILD_SHIPPING
+    if (!querySuccess)
+    {
+        // Even if query fails, we want to catch that debug information before exiting this function
+        m_DebugRenderer->UpdateSourceAcoustics(
+            sourceObjectId, sourceLocation, listenerLocation, querySuccess, objectParams, queryDebugInfo);
+        int  NumMessages;
+        const TritonRuntime::QueryDebugInfo::DebugMessage* Messages = queryDebugInfo.GetMessageList(NumMessages);
+        UE_LOG(LogAcousticsRuntime, Verbose, TEXT("%s : Query for ObjID[%llu] at [%.2f, %.2f, %.2f] failed with %d messages:"),
+            ANSI_TO_TCHAR(__FUNCTION__),
+            sourceObjectId,
+            sourceLocation.X,
+            sourceLocation.Y,
+            sourceLocation.Z,
+            NumMessages);
+        for (int i=0; i<NumMessages; i++)
+        {
+            UE_LOGFMT(LogAcousticsRuntime, Verbose, "  {0}", Messages[i].MessageString);
+        }
+        return false;
+    }
+#else
+    if (!querySuccess)
+    {
+        return false;
+    }
+#endif // !UE_BUILD_SHIPPING
+
+    // Caller passes in design adjustments for this emitter,
+    // update them with global adjustments
+    FAcousticsDesignParams::Combine(objectParams.Design, m_GlobalDesign);
+
+    // Set the remaining fields apart from design
+    objectParams.ObjectId = sourceObjectId;
+    objectParams.TritonParams = SmoothAcousticParameters(sourceObjectId, acousticParams);
+    objectParams.DynamicOpeningInfo = openingInfo;
+    // Outdoorness value is shared across all emitters heard by the same listener since it depends only on
+    // listener location, fill in that shared value.
+    objectParams.Outdoorness = GetOutdoornessForListener(listenerLocation);
+
+#if !UE_BUILD_SHIPPING
+    // If acoustics is disabled, intercept parameters headed to DSP
+    // and substitute "no acoustics" in all parameters - i.e. how it
+    // would sound if there were no geometry in the scene. Note that
+    // the system's internal logic such as doing queries, updating streaming
+    // etc. still remain active. This is intentional since the intended use
+    // case is for someone to do a quick A/B by toggling switch to hear difference
+    // such as for debugging.
+    if (!m_IsEnabled)
+    {
+        objectParams.TritonParams = MakeFreefieldParameters(sourceLocation, listenerLocation);
+        objectParams.Outdoorness = 1;
+    }
+
+    // Catch debug information for this source
+    m_DebugRenderer->UpdateSourceAcoustics(
+        sourceObjectId, sourceLocation, listenerLocation, querySuccess, objectParams, queryDebugInfo);
+#endif
+
+    return true;
+}
+
+// Returns the results of the last background query for this source and schedules a new one as its own task.
+// Returns false if the source was never registered.
+bool FProjectAcousticsModule::UpdatePerSourceQuery(
+    const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
+    const AcousticsObjectParams& objectParams, AcousticQueryResults& outResults)
+{
+    // We want to most acoustic queries on a background thread. So for each update call on a source, we will return any
+    // past results and queue up a query to run in the background and be ready for the next call.
+    auto slot = FindQuerySlot(sourceObjectId);
+    const auto state = slot != nullptr ? FPlatformAtomics::AtomicRead(&slot->State) : 0;
+    if ((state & c_QuerySlotRegistered) == 0)
+    {
+        LogUnregisteredSource(sourceObjectId);
+        return false;
+    }
+
+    // Have the results been published?
+    auto hasFreshResults = false;
+    if ((state & c_QuerySlotReady) != 0)
+    {
+        // Results are ready. The worker that published them is done with the slot, so it's safe to read them
+        outResults = slot->Results;
+        hasFreshResults = true;
+        slot->HasProcessed = true;
+        slot->HasLastResults = true;
+        FPlatformAtomics::InterlockedCompareExchange(&slot->State, state & ~c_QuerySlotReady, state);
+    }
+    // This is the first time this source is being processed. Use a warm-up result, or run the first acoustic query
+    // call directly on this calling thread if the sync budget allows it.
+    else if (!slot->HasProcessed)
+    {
+        if (GetFirstQueryResults(*slot, sourceLocation, listenerLocation, objectParams, outResults))
+        {
+            hasFreshResults = true;
+            slot->HasProcessed = true;
+            MarkQueried(*slot, sourceLocation, listenerLocation);
+
+            // Keep these around in case the next background query gets skipped. A query for the previous owner of
+            // the slot could still be writing the results, in which case the next update simply waits for a fresh
+            // query.
+            if (FPlatformAtomics::AtomicRead(&slot->QueuedWork->m_IsQueuedOrRunning) == 0)
+            {
+                slot->Results = outResults;
+                slot->HasLastResults = true;
+            }
+        }
+    }
+    // The last query was skipped because nothing moved or the budget ran out. Nothing is writing to the results, so
+    // reuse the previous ones.
+    else if (
+        slot->HasLastResults && FPlatformAtomics::AtomicRead(&slot->QueuedWork->m_IsQueuedOrRunning) == 0)
+    {
+        outResults = slot->Results;
+    }
+    else
+    {
+        // No results were ready and this is not the first time this source has been processed. This probably means
+        // a background query didn't complete in time.
+        UE_LOG(
+            LogAcousticsRuntime,
+            Warning,
+            TEXT("No acoustic query result found for source:%d. This most likely means a background query "
+                 "did not complete in time."),
+            sourceObjectId);
+    }
+    MarkUpdated(*slot, hasFreshResults);
+
+    // If the last query is still running, we don't want to schedule a new one and fall behind. Skip the
+    // scheduling, and try again next pass. Also wait if it published after we looked, so the next query can't
+    // overwrite results that haven't been read yet.
+    const auto queryStillRunning = FPlatformAtomics::AtomicRead(&slot->QueuedWork->m_IsQueuedOrRunning) != 0;
+    if (queryStillRunning || (FPlatformAtomics::AtomicRead(&slot->State) & c_QuerySlotReady) != 0)
+    {
+        return true;
+    }
+
+    // A source still waiting for its first results skips the throttling and the budget
+    const auto decision = slot->HasProcessed
+                              ? ShouldScheduleQuery(*slot, sourceLocation, listenerLocation, objectParams)
+                              : EAcousticQueryDecision::Run;
+    if (decision == EAcousticQueryDecision::Skip)
+    {
+        return true;
+    }
+
+    slot->IsFirstQueryPending = !slot->HasProcessed;
+    slot->SourceLocation = sourceLocation;
+    slot->ListenerLocation = listenerLocation;
+    slot->ObjectParams = objectParams;
+    slot->QueryGeneration = state >> c_QuerySlotGenerationShift;
+    if (decision == EAcousticQueryDecision::Defer)
+    {
+        DeferQuery(*slot, sourceLocation, listenerLocation, objectParams);
+    }
+    else
+    {
+        QueueSlotQuery(*slot);
+    }
+
+    return true;
+}
+
+// Hands the query described by the slot's inputs to the query worker the source is pinned to
+void FProjectAcousticsModule::QueueSlotQuery(FAcousticQuerySlot& slot)
+{
+    auto queryThreadPool = GetQueryThreadPool(slot.SourceObjectId);
+    if (queryThreadPool == nullptr)
+    {
+        return;
+    }
+
+    MarkQueried(slot, slot.SourceLocation, slot.ListenerLocation);
+
+    // Signal that we've queued this item
+    slot.QueuedWork->SignalStart();
+    slot.QueuedCycles = FPlatformTime::Cycles64();
+
+    // Add our query to the queue of the worker this source is pinned to
+    queryThreadPool->AddQueuedWork(slot.QueuedWork.Get());
+}
+
+// Runs on a query worker. Publishes the results unless the source was unregistered or re-registered meanwhile.
+void FProjectAcousticsModule::ProcessSlotQuery(FAcousticQuerySlot& slot)
+{
+    const auto queuedState = (slot.QueryGeneration << c_QuerySlotGenerationShift) | c_QuerySlotRegistered;
+    if (FPlatformAtomics::AtomicRead(&slot.State) != queuedState)
+    {
+        // The source is gone, don't bother running the query
+        return;
+    }
+
+    ACOUSTICS_TRACE_SCOPE("Acoustics::Query");
+    const auto startCycles = FPlatformTime::Cycles64();
+    slot.Results =
+        GetAcousticQueryResults(slot.SourceObjectId, slot.SourceLocation, slot.ListenerLocation, slot.ObjectParams);
+    if (AcousticsTrace::IsEnabled())
+    {
+        AcousticsTrace::OutputQuery(
+            static_cast<uint32>(slot.SourceObjectId),
+            slot.QueuedCycles,
+            startCycles,
+            FPlatformTime::Cycles64(),
+            slot.Results.QueryResult,
+            false);
+    }
+    FPlatformAtomics::InterlockedCompareExchange(&slot.State, queuedState | c_QuerySlotReady, queuedState);
+}
+
+// Returns the results of the last completed batch for this source and adds it to the pending batch.
+// Returns false if the source was never registered.
+bool FProjectAcousticsModule::UpdateBatchedQuery(
+    const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
+    const AcousticsObjectParams& objectParams, AcousticQueryResults& outResults)
+{
+    // Pick up the last batch as soon as it's done so its results are used this tick
+    CollectQueryBatchResults();
+
+    auto slot = FindQuerySlot(sourceObjectId);
+    const auto state = slot != nullptr ? FPlatformAtomics::AtomicRead(&slot->State) : 0;
+    if ((state & c_QuerySlotRegistered) == 0)
+    {
+        LogUnregisteredSource(sourceObjectId);
+        return false;
+    }
+
+    auto hasFreshResults = false;
+    if ((state & c_QuerySlotReady) != 0)
+    {
+        outResults = slot->Results;
+        hasFreshResults = true;
+        slot->HasLastResults = true;
+        FPlatformAtomics::InterlockedCompareExchange(&slot->State, state & ~c_QuerySlotReady, state);
+    }
+    // This is the first time this source is being processed. Use a warm-up result, or run the first acoustic query
+    // call directly on this calling thread if the sync budget allows it.
+    else if (!slot->HasProcessed)
+    {
+        if (GetFirstQueryResults(*slot, sourceLocation, listenerLocation, objectParams, outResults))
+        {
+            hasFreshResults = true;
+            slot->HasProcessed = true;
+            MarkQueried(*slot, sourceLocation, listenerLocation);
+            if (FPlatformAtomics::AtomicRead(&slot->QueuedWork->m_IsQueuedOrRunning) == 0)
+            {
+                slot->Results = outResults;
+                slot->HasLastResults = true;
+            }
+        }
+    }
+    // Batch results are only written on this thread, so the previous results can always be reused while the source
+    // waits for its next query
+    else if (
+        slot->HasLastResults && FPlatformAtomics::AtomicRead(&slot->QueuedWork->m_IsQueuedOrRunning) == 0)
+    {
+        outResults = slot->Results;
+    }
+    else
+    {
+        // No results were ready and this is not the first time this source has been processed. This probably means
+        // the last batch didn't complete in time.
+        UE_LOG(
+            LogAcousticsRuntime,
+            Verbose,
+            TEXT("No batched acoustic query result found for source:%d. This most likely means the last batch "
+                 "did not complete in time."),
+            sourceObjectId);
+    }
+    MarkUpdated(*slot, hasFreshResults);
+
+    // Queue up the query for the next batch. If the source is already in the pending batch, which happens while the
+    // previous batch is still running, only keep its latest inputs.
+    const auto generation = state >> c_QuerySlotGenerationShift;
+    if (slot->PendingJobIndex == INDEX_NONE)
+    {
+        // A source still waiting for its first results skips the throttling and the budget
+        if (!slot->HasProcessed && slot->IsFirstQueryPending)
+        {
+            return true;
+        }
+        const auto decision = slot->HasProcessed
+                                  ? ShouldScheduleQuery(*slot, sourceLocation, listenerLocation, objectParams)
+                                  : EAcousticQueryDecision::Run;
+        if (decision == EAcousticQueryDecision::Skip)
+        {
+            return true;
+        }
+
+        if (decision == EAcousticQueryDecision::Defer)
+        {
+            // The slot's query inputs are free unless a per-source query from before batching was turned on is
+            // still running. In that case just try again next update.
+            if (FPlatformAtomics::AtomicRead(&slot->QueuedWork->m_IsQueuedOrRunning) == 0)
+            {
+                slot->SourceLocation = sourceLocation;
+                slot->ListenerLocation = listenerLocation;
+                slot->ObjectParams = objectParams;
+                slot->QueryGeneration = generation;
+                DeferQuery(*slot, sourceLocation, listenerLocation, objectParams);
+            }
+            return true;
+        }
+
+        slot->PendingJobIndex = m_PendingQueryBatch.Add(static_cast<int32>(sourceObjectId), generation);
+        slot->IsFirstQueryPending = !slot->HasProcessed;
+    }
+    MarkQueried(*slot, sourceLocation, listenerLocation);
+    m_PendingQueryBatch.Set(slot->PendingJobIndex, generation, sourceLocation, listenerLocation, objectParams);
+
+    return true;
+}
+
+// Tracks the last two query results for the source and returns its parameters for the current time, ramping from
+// the earlier result to the latest one over the time it took the latest one to arrive.
+TritonAcousticParameters FProjectAcousticsModule::SmoothAcousticParameters(
+    const uint64_t sourceObjectId, const TritonAcousticParameters& latestParams)
+{
+    auto slot = FindQuerySlot(sourceObjectId);
+    if (c_TemporalSmoothing == 0 || slot == nullptr)
+    {
+        return latestParams;
+    }
+
+    const auto now = FPlatformTime::Seconds();
+    if (!slot->HasSmoothingTarget)
+    {
+        slot->SmoothingStart = latestParams;
+        slot->SmoothingTarget = latestParams;
+        slot->SmoothingStartTime = now;
+        slot->SmoothingDuration = 0.0;
+        slot->HasSmoothingTarget = true;
+        return latestParams;
+    }
+
+    // Skipped queries hand back the same results again, those don't restart the ramp
+    if (FMemory::Memcmp(&latestParams, &slot->SmoothingTarget, sizeof(TritonAcousticParameters)) != 0)
+    {
+        // Start from wherever the ramp currently is, so there's no step when results arrive early
+        slot->SmoothingStart = EvaluateSmoothing(*slot, now);
+        slot->SmoothingTarget = latestParams;
+        slot->SmoothingDuration =
+            FMath::Min(now - slot->SmoothingStartTime, static_cast<double>(c_TemporalSmoothingMaxTime));
+        slot->SmoothingStartTime = now;
+    }
+
+    return EvaluateSmoothing(*slot, now);
+}
+
+// Decides whether a source gets a new background query on this update. Called once per update that could schedule
+// one, so it also counts the updates since the source's last query.
+EAcousticQueryDecision FProjectAcousticsModule::ShouldScheduleQuery(
+    FAcousticQuerySlot& slot, const FVector& sourceLocation, const FVector& listenerLocation,
+    const AcousticsObjectParams& objectParams)
+{
+    slot.UpdatesSinceQuery++;
+
+    // Still waiting from last tick means nothing dispatched the deferred queries, which happens on engine versions
+    // without OnAllSourcesProcessed. Dispatch them now, this is the start of a new audio tick.
+    if (slot.IsDeferred)
+    {
+        DispatchDeferredQueries();
+    }
+
+    const auto movement = FMath::Max(
+        FVector::Dist(sourceLocation, slot.LastQuerySourceLocation),
+        FVector::Dist(listenerLocation, slot.LastQueryListenerLocation));
+
+    // Fast movers would be noticeably wrong if they had to wait, so they skip both the throttling and the budget
+    if (movement > c_QueryUrgentMovement)
+    {
+        return EAcousticQueryDecision::Run;
+    }
+
+    // Nothing moved, so a new query would return the same results. Dynamic openings can change without anything
+    // moving, so those sources are always refreshed.
+    if (c_AdaptiveQueries != 0 && movement <= c_QueryMovementThreshold &&
+        !objectParams.DynamicOpeningInfo.ApplyDynamicOpening && slot.UpdatesSinceQuery <= c_QueryMaxSkippedUpdates)
+    {
+        return EAcousticQueryDecision::Skip;
+    }
+
+    // With a limited budget, queries are ranked against each other at the end of the audio tick
+    return c_QueryBudgetPerFrame > 0 ? EAcousticQueryDecision::Defer : EAcousticQueryDecision::Run;
+}
+
+// Queues the slot's query for ranking. The slot's query inputs must already be set.
+void FProjectAcousticsModule::DeferQuery(
+    FAcousticQuerySlot& slot, const FVector& sourceLocation, const FVector& listenerLocation,
+    const AcousticsObjectParams& objectParams)
+{
+    // Louder and closer sources matter more. The loudness is the last known one, or 0 dB for sources that haven't
+    // had a successful query yet. Nothing writes the results while the source has no query running.
+    const auto distance = FMath::Max(
+        static_cast<float>(FVector::Dist(sourceLocation, listenerLocation)), c_QueryImportanceReferenceDistance);
+    const auto distanceDb = AcousticsUtils::AmplitudeToDb(c_QueryImportanceReferenceDistance / distance);
+    const auto loudnessDb =
+        slot.HasLastResults && slot.Results.QueryResult ? slot.Results.AcousticParams.Dry.LoudnessDb : 0.0f;
+
+    FDeferredAcousticQuery query;
+    query.SlotIndex = static_cast<int32>(slot.SourceObjectId);
+    query.Generation = slot.QueryGeneration;
+    query.Importance =
+        loudnessDb + distanceDb + objectParams.QueryPriority + slot.UpdatesSinceQuery * c_QueryStalenessImportance;
+    m_DeferredQueries.Add(query);
+    slot.IsDeferred = true;
+}
+
+// Starts as many of the deferred queries as the budget allows, most important first. The rest compete again on
+// their next update, with a little more importance for the extra wait.
+void FProjectAcousticsModule::DispatchDeferredQueries()
+{
+    if (m_DeferredQueries.Num() == 0)
+    {
+        return;
+    }
+
+    m_DeferredQueries.Sort([](const FDeferredAcousticQuery& a, const FDeferredAcousticQuery& b)
+                           { return a.Importance > b.Importance; });
+
+    const auto budget = FMath::Max(FPlatformAtomics::AtomicRead(&m_QueryBudgetRemaining), 0);
+    const auto numToDispatch = FMath::Min(budget, m_DeferredQueries.Num());
+    FPlatformAtomics::InterlockedAdd(&m_QueryBudgetRemaining, -numToDispatch);
+
+    for (auto i = 0; i < m_DeferredQueries.Num(); i++)
+    {
+        const auto& query = m_DeferredQueries[i];
+        auto& slot = *m_QuerySlots[query.SlotIndex];
+        slot.IsDeferred = false;
+
+        const auto queuedState = (query.Generation << c_QuerySlotGenerationShift) | c_QuerySlotRegistered;
+        if (i >= numToDispatch || FPlatformAtomics::AtomicRead(&slot.State) != queuedState ||
+            FPlatformAtomics::AtomicRead(&slot.QueuedWork->m_IsQueuedOrRunning) != 0)
+        {
+            continue;
+        }
+
+        if (c_BatchQueries != 0)
+        {
+            if (slot.PendingJobIndex == INDEX_NONE)
+            {
+                slot.PendingJobIndex = m_PendingQueryBatch.Add(query.SlotIndex, query.Generation);
+            }
+            MarkQueried(slot, slot.SourceLocation, slot.ListenerLocation);
+            m_PendingQueryBatch.Set(
+                slot.PendingJobIndex, query.Generation, slot.SourceLocation, slot.ListenerLocation, slot.ObjectParams);
+        }
+        else
+        {
+            QueueSlotQuery(slot);
+        }
+    }
+
+    m_DeferredQueries.Reset();
+}
+
+void FProjectAcousticsModule::MarkQueried(
+    FAcousticQuerySlot& slot, const FVector& sourceLocation, const FVector& listenerLocation)
+{
+    slot.LastQuerySourceLocation = sourceLocation;
+    slot.LastQueryListenerLocation = listenerLocation;
+    slot.UpdatesSinceQuery = 0;
+}
+
+// Counts the updates since the source last got fresh results, for the staleness trace
+void FProjectAcousticsModule::MarkUpdated(FAcousticQuerySlot& slot, const bool hasFreshResults)
+{
+    slot.UpdatesSinceFreshResult = hasFreshResults ? 0 : slot.UpdatesSinceFreshResult + 1;
+    m_MaxUpdatesSinceFreshResult = FMath::Max(m_MaxUpdatesSinceFreshResult, slot.UpdatesSinceFreshResult);
+    if (AcousticsTrace::IsEnabled())
+    {
+        AcousticsTrace::OutputSourceStaleness(static_cast<uint32>(slot.SourceObjectId), slot.UpdatesSinceFreshResult);
+    }
+}
+
+bool FProjectAcousticsModule::PostTick()
+{
+    if (!m_Triton)
+    {
+        return false;
+    }
+
+    m_TritonMemHook->SetBudget(static_cast<int64>(c_TritonMemoryBudgetMB) * 1024 * 1024);
+    UpdateAceSwap();
+    ProcessStreamingQueue();
+    EnforceMemoryBudget();
+    UpdateTritonStats();
+
+    {
+        FReadScopeLock lock(m_ListenersLock);
+        for (auto& listener : m_Listeners)
+        {
+            FPlatformAtomics::AtomicStore(&listener.IsOutdoornessStale, 1);
+        }
+    }
+    FPlatformAtomics::AtomicStore(&m_QueryBudgetRemaining, c_QueryBudgetPerFrame);
+    FPlatformAtomics::AtomicStore(&m_SyncQueryBudgetRemaining, c_SyncQueryBudgetPerFrame);
+    m_QueryCache.Tick();
+    return true;
+}
+
+void FProjectAcousticsModule::PostAudioTick()
+{
+    if (!m_Triton || !m_AceFileLoaded)
+    {
+        return;
+    }
+
+    ACOUSTICS_TRACE_SCOPE("Acoustics::PostAudioTick");
+    TRACE_COUNTER_SET(Acoustics_MaxUpdatesSinceFreshResult, m_MaxUpdatesSinceFreshResult);
+    m_MaxUpdatesSinceFreshResult = 0;
+
+    DispatchDeferredQueries();
+    CollectQueryBatchResults();
+
+    // Only one batch runs at a time. Pending queries stay in place and go out once the previous batch is done.
+    if (m_IsQueryBatchInFlight || m_PendingQueryBatch.Num() == 0)
+    {
+        return;
+    }
+
+    const auto numJobs = m_PendingQueryBatch.Num();
+    const auto numChunks = FMath::Min(
+        FPlatformAtomics::AtomicRead(&m_NumActiveQueryThreadPools),
+        FMath::DivideAndRoundUp(numJobs, c_MinQueryBatchChunkSize));
+    if (numChunks == 0)
+    {
+        return;
+    }
+
+    Swap(m_PendingQueryBatch, m_InFlightQueryBatch);
+    m_PendingQueryBatch.Reset();
+    for (const auto slotIndex : m_InFlightQueryBatch.SourceSlots)
+    {
+        m_QuerySlots[slotIndex]->PendingJobIndex = INDEX_NONE;
+    }
+    m_InFlightQueryBatchResults.SetNum(numJobs, false);
+
+    while (m_QueryBatchWork.Num() < numChunks)
+    {
+        const auto chunkIndex = m_QueryBatchWork.Num();
+        m_QueryBatchWork.Add(MakeUnique<FAcousticsQueuedWork>(
+            [this, chunkIndex]() { ProcessQueryBatchChunk(chunkIndex); }, &m_RunningTasks));
+    }
+
+    // Split the batch into contiguous ranges of jobs, one per query worker
+    const auto jobsPerChunk = FMath::DivideAndRoundUp(numJobs, numChunks);
+    m_QueryBatchChunkRanges.SetNum(numChunks, false);
+    for (auto i = 0; i < numChunks; i++)
+    {
+        const auto begin = i * jobsPerChunk;
+        m_QueryBatchChunkRanges[i] = TPair<int32, int32>(begin, FMath::Min(begin + jobsPerChunk, numJobs));
+    }
+
+    m_IsQueryBatchInFlight = true;
+    m_InFlightQueryBatchCycles = FPlatformTime::Cycles64();
+    for (auto i = 0; i < numChunks; i++)
+    {
+        m_QueryBatchWork[i]->SignalStart();
+        m_QueryThreadPools[i]->AddQueuedWork(m_QueryBatchWork[i].Get());
+    }
+}
+
+// Runs on a query worker. Each chunk only reads and writes its own range of jobs.
+void FProjectAcousticsModule::ProcessQueryBatchChunk(const int32 chunkIndex)
+{
+    const auto& batch = m_InFlightQueryBatch;
+    const auto& range = m_QueryBatchChunkRanges[chunkIndex];
+
+    ACOUSTICS_TRACE_SCOPE("Acoustics::QueryBatchChunk");
+    const auto isTracing = AcousticsTrace::IsEnabled();
+    for (auto i = range.Key; i < range.Value; i++)
+    {
+        // Jobs can be for different listeners, each of which needs its outdoorness refreshed. Only the first update
+        // of a listener per tick does any work, so it's enough to skip jobs that share the previous job's listener.
+        if (i == range.Key || batch.ListenerLocations[i] != batch.ListenerLocations[i - 1])
+        {
+            UpdateOutdoorness(batch.ListenerLocations[i]);
+        }
+        const auto startCycles = isTracing ? FPlatformTime::Cycles64() : 0;
+        m_InFlightQueryBatchResults[i] = RunAcousticQuery(
+            batch.SourceLocations[i], batch.ListenerLocations[i], batch.OpeningInfos[i], batch.InterpolationConfigs[i]);
+        if (isTracing)
+        {
+            AcousticsTrace::OutputQuery(
+                static_cast<uint32>(batch.SourceSlots[i]),
+                m_InFlightQueryBatchCycles,
+                startCycles,
+                FPlatformTime::Cycles64(),
+                m_InFlightQueryBatchResults[i].QueryResult,
+                true);
+        }
+    }
+}
+
+// If the in-flight batch has finished, hand its results to the sources that are still registered
+void FProjectAcousticsModule::CollectQueryBatchResults()
+{
+    if (!m_IsQueryBatchInFlight)
+    {
+        return;
+    }
+
+    for (const auto& work : m_QueryBatchWork)
+    {
+        if (FPlatformAtomics::AtomicRead(&work->m_IsQueuedOrRunning) != 0)
+        {
+            return;
+        }
+    }
+
+    const auto& batch = m_InFlightQueryBatch;
+    for (auto i = 0; i < batch.Num(); i++)
+    {
+        auto& slot = *m_QuerySlots[batch.SourceSlots[i]];
+        const auto batchState = (batch.SlotGenerations[i] << c_QuerySlotGenerationShift) | c_QuerySlotRegistered;
+        // If the results can't be handed out, a source still waiting for its first results tries again
+        slot.IsFirstQueryPending = false;
+
+        // Skip sources that went away, and sources whose per-source query (from before PA.BatchQueries was turned
+        // on) still owns the results
+        if (FPlatformAtomics::AtomicRead(&slot.State) == batchState &&
+            FPlatformAtomics::AtomicRead(&slot.QueuedWork->m_IsQueuedOrRunning) == 0)
+        {
+            slot.Results = MoveTemp(m_InFlightQueryBatchResults[i]);
+            slot.HasProcessed = true;
+            FPlatformAtomics::InterlockedCompareExchange(&slot.State, batchState | c_QuerySlotReady, batchState);
+        }
+    }
+
+    m_InFlightQueryBatch.Reset();
+    m_IsQueryBatchInFlight = false;
+}
+
+bool FProjectAcousticsModule::UpdateDistances(const FVector& listenerLocation)
+{
+    if (!m_Triton)
+    {
+        return false;
+    }
+
+    auto listener = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(listenerLocation));
+    return m_Triton->UpdateDistancesForListener(listener);
+}
+
+bool FProjectAcousticsModule::QueryDistance(const FVector& lookDirection, float& outDistance)
+{
+    if (!m_Triton)
+    {
+        outDistance = 0;
+        return false;
+    }
+
+    auto dir = AcousticsUtils::ToTritonVector(WorldDirectionToTriton(lookDirection));
+    outDistance = m_Triton->QueryDistanceForListener(dir) * AcousticsUtils::c_TritonToUnrealScale;
+    return true;
+}
+
+static float LoadOutdoorness(const FAcousticListenerState& listenerState)
+{
+    const auto bits = FPlatformAtomics::AtomicRead(&listenerState.OutdoornessBits);
+    float outdoorness;
+    FMemory::Memcpy(&outdoorness, &bits, sizeof(outdoorness));
+    return outdoorness;
+}
+
+static void StoreOutdoorness(FAcousticListenerState& listenerState, const float outdoorness)
+{
+    int32 bits;
+    FMemory::Memcpy(&bits, &outdoorness, sizeof(bits));
+    FPlatformAtomics::AtomicStore(&listenerState.OutdoornessBits, bits);
+}
+
+bool FProjectAcousticsModule::UpdateOutdoorness(const FVector& listenerLocation)
+{
+    if (!m_Triton)
+    {
+        return false;
+    }
+
+    // This function will be called by each sound source in a frame.
+    // Since outdoorness depends only on player location, we do work
+    // only once per frame, regardless of whether query succeeds or fails.
+    // In case of failure, we leave the old cached outdoorness value unmodified.
+    // This is called from every query worker, so only the worker that claims the stale flag does the update.
+    // The others keep using the previously cached value.
+    FReadScopeLock lock(m_ListenersLock);
+    auto& listenerState = m_Listeners[FindClosestListener(listenerLocation)];
+    if (FPlatformAtomics::InterlockedCompareExchange(&listenerState.IsOutdoornessStale, 0, 1) == 1)
+    {
+        auto listener = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(listenerLocation));
+        bool success = false;
+        {
+            SCOPE_CYCLE_COUNTER(STAT_Acoustics_QueryOutdoorness);
+            auto outdoorness = 0.0f;
+            FReadScopeLock tritonLock(m_TritonLock);
+            success = m_Triton->GetOutdoornessAtListener(listener, outdoorness);
+            if (success)
+            {
+                const float NormalizedVal =
+                    (outdoorness - c_OutdoornessIndoors) / (c_OutdoornessOutdoors - c_OutdoornessIndoors);
+                StoreOutdoorness(listenerState, FMath::Clamp(NormalizedVal, 0.0f, 1.0f));
+            }
+        }
+
+        return success;
+    }
+
+    return true;
+}
+
+inline float FProjectAcousticsModule::GetOutdoorness() const
+{
+    FReadScopeLock lock(m_ListenersLock);
+    return LoadOutdoorness(m_Listeners[0]);
+}
+
+float FProjectAcousticsModule::GetOutdoornessForListener(const FVector& listenerLocation) const
+{
+    FReadScopeLock lock(m_ListenersLock);
+    return LoadOutdoorness(m_Listeners[FindClosestListener(listenerLocation)]);
+}
+
+void FProjectAcousticsModule::SetListenerLocations(TArrayView<const FVector> listenerLocations)
+{
+    const auto numListeners = FMath::Clamp(listenerLocations.Num(), 1, c_MaxAcousticListeners);
+
+    FWriteScopeLock lock(m_ListenersLock);
+    // New listeners start out stale, so their outdoorness is computed by their first update
+    m_Listeners.SetNum(numListeners);
+    for (auto i = 0; i < FMath::Min(listenerLocations.Num(), numListeners); i++)
+    {
+        m_Listeners[i].Location = listenerLocations[i];
+    }
+}
+
+// Must be called with the listeners lock held
+int32 FProjectAcousticsModule::FindClosestListener(const FVector& listenerLocation) const
+{
+    auto closest = 0;
+    auto closestDistSquared = FVector::DistSquared(m_Listeners[0].Location, listenerLocation);
+    for (auto i = 1; i < m_Listeners.Num(); i++)
+    {
+        const auto distSquared = FVector::DistSquared(m_Listeners[i].Location, listenerLocation);
+        if (distSquared < closestDistSquared)
+        {
+            closest = i;
+            closestDistSquared = distSquared;
+        }
+    }
+    return closest;
+}
+
+bool FProjectAcousticsModule::CalculateReverbSendWeights(
+    const float targetReverbTime, const uint32_t numReverbs, const float* reverbTimes, float* reverbSendWeights) const
+{
+    return TritonAcoustics::CalculateReverbSendWeights(targetReverbTime, numReverbs, reverbTimes, reverbSendWeights);
+}
+
+
+bool FProjectAcousticsModule::GetAcousticParameters(
+    const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& params,
+    TritonDynamicOpeningInfo& outOpeningInfo, const InterpolationConfig& interpConfig, TritonRuntime::QueryDebugInfo* outDebugInfo /* = nullptr */)
+{
+    auto source = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(sourceLocation));
+    auto listener = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(listenerLocation));
+
+    bool acousticParamsValid = false;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_Acoustics_Query);
+        // Keeps a hot-swap from replacing the instance in the middle of the query
+        FReadScopeLock tritonLock(m_TritonLock);
+
+        // TritonAcoustics::QueryAcoustics is const and only reads the loaded probe data, so it is safe to call
+        // concurrently from all query workers. The debug overload is not const and is serialized instead.
+#if !UE_BUILD_SHIPPING
+        if (outDebugInfo != nullptr)
+        {
+            FScopeLock lock(&m_DebugQueryLock);
+            acousticParamsValid = GetTritonDebugInstance()->QueryAcoustics(
+                source, listener, params, outOpeningInfo, &interpConfig, outDebugInfo);
+        }
+        else
+#endif
+        {
+            acousticParamsValid = m_Triton->QueryAcoustics(source, listener, params, outOpeningInfo, &interpConfig);
+        }
+    }
+
+    m_NumQueries.Add(1);
+    if (!acousticParamsValid)
+    {
+        m_NumFailedQueries.Add(1);
+    }
+
+    return acousticParamsValid;
+}
+
+// Wait for any remaining background queries to finish. Sleeps until the last one signals, and reports what is still
+// outstanding whenever the wait takes suspiciously long.
+void FProjectAcousticsModule::WaitForRunningTasks()
+{
+    auto waitedSeconds = 0.0;
+    while (!m_RunningTasks.Wait(c_TaskWaitWarningSeconds))
+    {
+        waitedSeconds += c_TaskWaitWarningSeconds;
+        UE_LOG(
+            LogAcousticsRuntime,
+            Warning,
+            TEXT("Still waiting for %d background acoustic queries after %.0f seconds"),
+            m_RunningTasks.GetCount(),
+            waitedSeconds);
+        LogRunningTasks();
+    }
+}
+
+// Lists the work items that are queued or running
+void FProjectAcousticsModule::LogRunningTasks() const
+{
+    for (const auto& slot : m_QuerySlots)
+    {
+        if (FPlatformAtomics::AtomicRead(&slot->QueuedWork->m_IsQueuedOrRunning) != 0)
+        {
+            UE_LOG(LogAcousticsRuntime, Warning, TEXT("  Query for source:%llu"), slot->SourceObjectId);
+        }
+    }
+    for (auto i = 0; i < m_WarmUpQueries.Num(); i++)
+    {
+        if (FPlatformAtomics::AtomicRead(&m_WarmUpQueries[i].QueuedWork->m_IsQueuedOrRunning) != 0)
+        {
+            UE_LOG(LogAcousticsRuntime, Warning, TEXT("  Warm-up query %d"), i);
+        }
+    }
+    for (auto i = 0; i < m_QueryBatchWork.Num(); i++)
+    {
+        if (FPlatformAtomics::AtomicRead(&m_QueryBatchWork[i]->m_IsQueuedOrRunning) != 0)
+        {
+            UE_LOG(LogAcousticsRuntime, Warning, TEXT("  Query batch chunk %d"), i);
+        }
+    }
+}
+
+// Make sure the number of query workers matches the desired count. Safe while queries are being scheduled: a source's
+// work item is never queued twice, so work still queued on the pool a source used to be pinned to simply finishes
+// there, and the next query goes to the new pool.
+void FProjectAcousticsModule::RefreshQueryThreadPools()
+{
+    auto numThreads = c_NumQueryWorkerThreads >= 0 ? c_NumQueryWorkerThreads
+                                                   : GetDefault<UAcousticsRuntimeSettings>()->NumQueryWorkerThreads;
+    if (numThreads == 0)
+    {
+        // Leave room for the game, render and audio threads
+        numThreads = FPlatformMisc::NumberOfCoresIncludingHyperthreads() - 3;
+    }
+    numThreads = FMath::Clamp(numThreads, 1, c_MaxQueryWorkerThreads);
+
+    if (FPlatformAtomics::AtomicRead(&m_NumActiveQueryThreadPools) == numThreads)
+    {
+        return;
+    }
+
+    // Pools beyond the active count are kept around idle rather than destroyed, so that the audio thread never sees
+    // a pool go away underneath it. The array was reserved up front and the count is only published once the pools
+    // exist, so growing it doesn't move the pools the audio thread is reading.
+    while (m_QueryThreadPools.Num() < numThreads)
+    {
+        // One thread per pool, so that all queries in a pool happen one at a time
+        auto threadPool = FQueuedThreadPool::Allocate();
+        threadPool->Create(
+            1, 32 * 1024, TPri_Normal, *FString::Printf(TEXT("AcousticsQueryWorker%d"), m_QueryThreadPools.Num()));
+        m_QueryThreadPools.Add(threadPool);
+    }
+    FPlatformAtomics::AtomicStore(&m_NumActiveQueryThreadPools, numThreads);
+
+    UE_LOG(LogAcousticsRuntime, Log, TEXT("Running acoustic queries on %d worker thread(s)"), numThreads);
+}
+
+void FProjectAcousticsModule::DestroyQueryThreadPools()
+{
+    FPlatformAtomics::AtomicStore(&m_NumActiveQueryThreadPools, 0);
+    for (auto threadPool : m_QueryThreadPools)
+    {
+        threadPool->Destroy();
+        delete threadPool;
+    }
+    m_QueryThreadPools.Reset();
+}
+
+// The threads Triton streams probes in on. Created on first use, and shared by every Triton instance.
+FQueuedThreadPool* FProjectAcousticsModule::GetStreamingThreadPool()
+{
+    if (m_StreamingThreadPool == nullptr)
+    {
+        const auto numThreads = FMath::Clamp(c_NumStreamingThreads, 1, c_MaxStreamingThreads);
+        const auto priority = c_StreamingThreadPriority <= 0   ? TPri_BelowNormal
+                              : c_StreamingThreadPriority == 1 ? TPri_Normal
+                                                               : TPri_AboveNormal;
+        m_StreamingThreadPool = FQueuedThreadPool::Allocate();
+        m_StreamingThreadPool->Create(numThreads, c_StreamingThreadStackSize, priority, TEXT("AcousticsStreaming"));
+
+        UE_LOG(LogAcousticsRuntime, Log, TEXT("Streaming acoustic probes on %d thread(s)"), numThreads);
+    }
+    return m_StreamingThreadPool;
+}
+
+// Must be called after every task hook using the pool is gone
+void FProjectAcousticsModule::DestroyStreamingThreadPool()
+{
+    if (m_StreamingThreadPool != nullptr)
+    {
+        m_StreamingThreadPool->Destroy();
+        delete m_StreamingThreadPool;
+        m_StreamingThreadPool = nullptr;
+    }
+}
+
+// Sources are pinned to a worker by ID
+FQueuedThreadPool* FProjectAcousticsModule::GetQueryThreadPool(const uint64_t sourceObjectId) const
+{
+    const auto numThreadPools = FPlatformAtomics::AtomicRead(&m_NumActiveQueryThreadPools);
+    if (numThreadPools == 0)
+    {
+        return nullptr;
+    }
+    return m_QueryThreadPools[sourceObjectId % static_cast<uint64_t>(numThreadPools)];
+}
+
+FAcousticQuerySlot* FProjectAcousticsModule::FindQuerySlot(const uint64_t sourceObjectId) const
+{
+    return sourceObjectId < static_cast<uint64_t>(m_QuerySlots.Num()) ? m_QuerySlots[sourceObjectId].Get() : nullptr;
+}
 
 void FProjectAcousticsModule::UpdateLoadedRegion(
     const FVector& playerPosition, const FVector& tileSize, const bool forceUpdate, const bool unloadProbesOutsideTile,
     const bool blockOnCompletion)
 {
-    if (!m_Triton)
+    UpdateLoadedRegionPredictive(
+        playerPosition, FVector::ZeroVector, 0.0f, tileSize, forceUpdate, unloadProbesOutsideTile, blockOnCompletion);
+}
+
+void FProjectAcousticsModule::UpdateLoadedRegionPredictive(
+    const FVector& playerPosition, const FVector& playerVelocity, const float predictionTime, const FVector& tileSize,
+    const bool forceUpdate, const bool unloadProbesOutsideTile, const bool blockOnCompletion)
+{
+    UpdateLoadedRegions(
+        MakeArrayView(&playerPosition, 1),
+        MakeArrayView(&playerVelocity, 1),
+        predictionTime,
+        tileSize,
+        forceUpdate,
+        unloadProbesOutsideTile,
+        blockOnCompletion);
+}
+
+// Whether position is far enough from the border of the region that it doesn't need to be reloaded yet
+static bool IsInsideLoadMargin(const FAcousticLoadedRegion& region, const FVector& position)
+{
+    const auto difference = (position - region.Center).GetAbs();
+    const auto loadThreshold = region.Size * c_AceTileLoadMargin * 0.5f;
+    return difference.X <= loadThreshold.X && difference.Y <= loadThreshold.Y && difference.Z <= loadThreshold.Z;
+}
+
+// Everything a listener has loaded through paced streaming, current tile and stale ones
+static FBox GetStreamedTileBounds(const FAcousticStreamedTile& tile)
+{
+    auto bounds = tile.StaleBounds;
+    if (!tile.LoadedRegion.Size.IsZero())
+    {
+        bounds += FBox::BuildAABB(tile.LoadedRegion.Center, tile.LoadedRegion.Size * 0.5f);
+    }
+    return bounds;
+}
+
+void FProjectAcousticsModule::UpdateLoadedRegions(
+    TArrayView<const FVector> listenerPositions, TArrayView<const FVector> listenerVelocities,
+    const float predictionTime, const FVector& tileSize, const bool forceUpdate, const bool unloadProbesOutsideTile,
+    const bool blockOnCompletion)
+{
+    check(listenerVelocities.Num() == listenerPositions.Num());
+    if (!m_Triton || listenerPositions.Num() == 0)
+    {
+        return;
+    }
+
+    const auto numListeners = FMath::Min(listenerPositions.Num(), c_MaxAcousticListeners);
+    // Tile Size must be all positive values, otherwise triton fails to load probes
+    const auto absTileSize = tileSize.GetAbs() * m_TileEvictionScale;
+    m_TileListenerPositions.Reset();
+    m_TileListenerPositions.Append(listenerPositions.GetData(), numListeners);
+
+    TArray<FAcousticLoadedRegion, TInlineAllocator<c_MaxAcousticListeners>> regions;
+    regions.SetNum(numListeners);
+    bool isRegionChanged[c_MaxAcousticListeners] = {};
+    auto hasChanged = numListeners != m_LoadedRegions.Num();
+    for (auto i = 0; i < numListeners; i++)
+    {
+        // Where the listener is expected to be once the prediction horizon has passed. The offset is capped at a
+        // tile, so a region never grows past twice the tile size along any axis.
+        const auto& listenerPosition = listenerPositions[i];
+        const auto predictedOffset =
+            (listenerVelocities[i] * FMath::Max(predictionTime, 0.0f)).BoundToBox(-absTileSize, absTileSize);
+
+        // Reload once either the listener or its predicted position gets close to the border of its region. Empty
+        // regions are ones that failed to load.
+        const auto needsReload = forceUpdate || i >= m_LoadedRegions.Num() || m_LoadedRegions[i].Size.IsZero() ||
+                                 !IsInsideLoadMargin(m_LoadedRegions[i], listenerPosition) ||
+                                 !IsInsideLoadMargin(m_LoadedRegions[i], listenerPosition + predictedOffset);
+        if (needsReload)
+        {
+            // Cover both the tile around the listener and the tile around the predicted position
+            regions[i].Center = listenerPosition + predictedOffset * 0.5f;
+            regions[i].Size = absTileSize + predictedOffset.GetAbs();
+            isRegionChanged[i] = true;
+            hasChanged = true;
+        }
+        else
+        {
+            regions[i] = m_LoadedRegions[i];
+        }
+    }
+
+    if (!hasChanged)
+    {
+        return;
+    }
+
+    if (!blockOnCompletion && IsStreamingPaced())
+    {
+        // Listeners that went away take their tiles with them
+        if (m_StreamedTiles.Num() > numListeners)
+        {
+            for (auto i = numListeners; unloadProbesOutsideTile && i < m_StreamedTiles.Num(); i++)
+            {
+                const auto bounds = GetStreamedTileBounds(m_StreamedTiles[i]);
+                if (bounds.IsValid)
+                {
+                    UnloadTritonBounds(bounds);
+                }
+            }
+            m_StreamedTiles.SetNum(numListeners);
+            m_StreamingQueue.RemoveAll([numListeners](const FAcousticStreamingChunk& chunk)
+                                       { return chunk.ListenerIndex >= numListeners; });
+            // Cancels the unloads of probes that are still in some listener's tile
+            ReloadStreamedTiles(INDEX_NONE);
+        }
+        m_StreamedTiles.SetNum(numListeners);
+
+        // Start the changed tiles over. Whatever they had loaded becomes stale, and is unloaded once the new tile is
+        // complete.
+        m_StreamingQueue.RemoveAll([&isRegionChanged](const FAcousticStreamingChunk& chunk)
+                                   { return isRegionChanged[chunk.ListenerIndex]; });
+        for (auto i = 0; i < numListeners; i++)
+        {
+            auto& tile = m_StreamedTiles[i];
+            if (isRegionChanged[i])
+            {
+                tile.StaleBounds = GetStreamedTileBounds(tile);
+                tile.LoadedRegion = FAcousticLoadedRegion();
+            }
+        }
+
+        // Step k of n is the tile scaled by k/n towards the listener, so each box contains the one before it and the
+        // last one is the whole tile. Steps are interleaved across listeners, so every listener gets its nearest
+        // probes before anyone gets their farthest.
+        const auto numSteps = FMath::Max(c_StreamingSteps, 1);
+        for (auto step = 1; step <= numSteps; step++)
+        {
+            const auto alpha = static_cast<float>(step) / numSteps;
+            for (auto i = 0; i < numListeners; i++)
+            {
+                if (isRegionChanged[i])
+                {
+                    FAcousticStreamingChunk chunk;
+                    chunk.ListenerIndex = i;
+                    chunk.Region.Center = FMath::Lerp(listenerPositions[i], regions[i].Center, alpha);
+                    chunk.Region.Size = regions[i].Size * alpha;
+                    chunk.IsFinal = step == numSteps;
+                    m_StreamingQueue.Add(chunk);
+                }
+            }
+        }
+
+        m_UnloadProbesOutsideTile = unloadProbesOutsideTile;
+        m_LoadedRegions = regions;
+        return;
+    }
+
+    // Tiles that are still being streamed in are completed now as well
+    for (const auto& chunk : m_StreamingQueue)
+    {
+        if (chunk.ListenerIndex < numListeners)
+        {
+            isRegionChanged[chunk.ListenerIndex] = true;
+        }
+    }
+
+    auto hasLoaded = false;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadRegion);
+        if (numListeners == 1)
+        {
+            // A single tile replaces everything that was loaded before
+            if (LoadTritonRegion(m_Triton, regions[0], unloadProbesOutsideTile, blockOnCompletion) >= 0)
+            {
+                hasLoaded = true;
+            }
+            else
+            {
+                regions[0] = m_LoadedRegions.Num() > 0 ? m_LoadedRegions[0] : FAcousticLoadedRegion();
+            }
+        }
+        else
+        {
+            // Unload the tiles being replaced before loading the new ones. Triton cancels unloads of probes that are
+            // loaded again right after, so probes that stay inside some listener's tile cost no IO.
+            auto hasUnloaded = false;
+            for (auto i = 0; unloadProbesOutsideTile && i < m_LoadedRegions.Num(); i++)
+            {
+                if (i >= numListeners || isRegionChanged[i])
+                {
+                    const auto& region = m_LoadedRegions[i];
+                    m_Triton->UnloadRegion(
+                        AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(region.Center)),
+                        AcousticsUtils::ToTritonVectorDouble(WorldScaleToTriton(region.Size).GetAbs()),
+                        false);
+                    hasUnloaded = true;
+                }
+            }
+            // So are the tiles paced streaming left behind
+            for (auto i = 0; unloadProbesOutsideTile && i < m_StreamedTiles.Num(); i++)
+            {
+                if (m_StreamedTiles[i].StaleBounds.IsValid)
+                {
+                    UnloadTritonBounds(m_StreamedTiles[i].StaleBounds);
+                    hasUnloaded = true;
+                }
+            }
+
+            for (auto i = 0; i < numListeners; i++)
+            {
+                if (isRegionChanged[i] || hasUnloaded)
+                {
+                    // Tiles that stay are loaded again too, in case they overlap a tile that was unloaded
+                    if (LoadTritonRegion(m_Triton, regions[i], false, blockOnCompletion && isRegionChanged[i]) >= 0)
+                    {
+                        hasLoaded = true;
+                    }
+                    else if (isRegionChanged[i])
+                    {
+                        // An empty region is reloaded on the next update
+                        regions[i] = FAcousticLoadedRegion{listenerPositions[i], FVector::ZeroVector};
+                    }
+                }
+            }
+        }
+    }
+
+    m_LoadedRegions = regions;
+    ResetStreamedTiles();
+    if (hasLoaded)
+    {
+        // The set of loaded probes changed, so results for the same positions may change too
+        m_QueryCache.Reset();
+    }
+}
+
+// Returns the number of probes Triton will load, or -1 on failure
+int32 FProjectAcousticsModule::LoadTritonRegion(
+    TritonAcoustics* triton, const FAcousticLoadedRegion& region, const bool unloadOutside,
+    const bool blockOnCompletion)
+{
+    ACOUSTICS_TRACE_SCOPE("Acoustics::LoadRegion");
+    const auto startCycles = FPlatformTime::Cycles64();
+    const auto startBytesRead = TritonRuntime::FTritonUnrealIOHook::GetBytesReadOnThisThread();
+    const auto numProbes = triton->LoadRegion(
+        AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(region.Center)),
+        AcousticsUtils::ToTritonVectorDouble(WorldScaleToTriton(region.Size).GetAbs()),
+        unloadOutside,
+        blockOnCompletion);
+    if (AcousticsTrace::IsEnabled())
+    {
+        AcousticsTrace::OutputTileLoad(
+            region.Center,
+            region.Size,
+            startCycles,
+            FPlatformTime::Cycles64(),
+            numProbes,
+            TritonRuntime::FTritonUnrealIOHook::GetBytesReadOnThisThread() - startBytesRead,
+            blockOnCompletion);
+    }
+    m_NumTileLoads.Add(1);
+    if (numProbes >= 0)
+    {
+        m_NumProbesRequested.Add(numProbes);
+    }
+    else
+    {
+        m_NumFailedTileLoads.Add(1);
+    }
+    return numProbes;
+}
+
+void FProjectAcousticsModule::UnloadTritonBounds(const FBox& bounds)
+{
+    m_Triton->UnloadRegion(
+        AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(bounds.GetCenter())),
+        AcousticsUtils::ToTritonVectorDouble(WorldScaleToTriton(bounds.GetSize()).GetAbs()),
+        false);
+}
+
+bool FProjectAcousticsModule::IsStreamingPaced() const
+{
+    return c_StreamingSteps > 1 || c_StreamingBandwidthKBps > 0 || c_StreamingMemoryCeilingMB > 0 ||
+           c_StreamingMaxProbesPerFrame > 0;
+}
+
+// Sends the queued tile loads to Triton as the budgets allow. Triton serves the most recent load first, so a round of
+// chunks goes out only once the previous round has finished streaming. Otherwise the outer boxes of a tile would
+// load ahead of the inner ones, and a round could never be held back for bandwidth or memory.
+void FProjectAcousticsModule::ProcessStreamingQueue()
+{
+    // Refill the bandwidth budget for the time passed, and charge it for what was actually read
+    const auto now = FPlatformTime::Seconds();
+    const auto bytesRead = GetTotalBytesRead();
+    // Reads from before the first update, such as loading the ACE file, aren't charged
+    if (c_StreamingBandwidthKBps > 0 && m_LastStreamingUpdateTime > 0.0)
+    {
+        const auto bytesPerSecond = c_StreamingBandwidthKBps * 1024.0;
+        m_StreamingBandwidthBudget +=
+            bytesPerSecond * (now - m_LastStreamingUpdateTime) - (bytesRead - m_LastStreamingBytesRead);
+        // Time spent idle banks at most a second of reads
+        m_StreamingBandwidthBudget = FMath::Min(m_StreamingBandwidthBudget, bytesPerSecond);
+    }
+    else
+    {
+        m_StreamingBandwidthBudget = 0.0;
+    }
+    m_LastStreamingUpdateTime = now;
+    m_LastStreamingBytesRead = bytesRead;
+
+    SET_DWORD_STAT(STAT_Acoustics_StreamingQueueDepth, m_StreamingQueue.Num());
+    SET_DWORD_STAT(
+        STAT_Acoustics_StreamingBacklogKB,
+        static_cast<uint32>(FMath::Max(-m_StreamingBandwidthBudget, 0.0) / 1024.0));
+
+    if (m_StreamingQueue.Num() == 0 || !m_AceFileLoaded)
+    {
+        return;
+    }
+    if (m_TritonTaskHook.IsValid() && !m_TritonTaskHook->IsIdle())
+    {
+        return;
+    }
+    if (c_StreamingBandwidthKBps > 0 && m_StreamingBandwidthBudget <= 0.0)
+    {
+        return;
+    }
+
+    // Over the memory ceiling, what the listeners left behind is unloaded before anything new comes in. With nothing
+    // left to unload, streaming holds until memory goes down.
+    auto releaseStale = false;
+    if (c_StreamingMemoryCeilingMB > 0 &&
+        m_TritonMemHook->GetTotalMemoryUsed() > static_cast<int64>(c_StreamingMemoryCeilingMB) * 1024 * 1024)
+    {
+        if (!m_StreamedTiles.ContainsByPredicate([](const FAcousticStreamedTile& tile)
+                                                 { return tile.StaleBounds.IsValid != 0; }))
+        {
+            return;
+        }
+        releaseStale = true;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadRegion);
+
+    // One chunk per listener per round, so that a listener's boxes still load in order
+    uint32 roundListeners = 0;
+    uint32 failedListeners = 0;
+    auto numProbes = 0;
+    auto numIssued = 0;
+    while (numIssued < m_StreamingQueue.Num())
+    {
+        if (c_StreamingMaxProbesPerFrame > 0 && numProbes >= c_StreamingMaxProbesPerFrame)
+        {
+            break;
+        }
+        const auto& chunk = m_StreamingQueue[numIssued];
+        const auto listenerBit = 1u << chunk.ListenerIndex;
+        if ((roundListeners & listenerBit) != 0)
+        {
+            break;
+        }
+        roundListeners |= listenerBit;
+
+        const auto chunkProbes = IssueStreamingChunk(chunk, releaseStale);
+        if (chunkProbes >= 0)
+        {
+            numProbes += chunkProbes;
+        }
+        else
+        {
+            // An empty region is reloaded on the next update
+            failedListeners |= listenerBit;
+            m_LoadedRegions[chunk.ListenerIndex].Size = FVector::ZeroVector;
+        }
+        numIssued++;
+    }
+
+    m_StreamingQueue.RemoveAt(0, numIssued, false);
+    if (failedListeners != 0)
+    {
+        m_StreamingQueue.RemoveAll([failedListeners](const FAcousticStreamingChunk& chunk)
+                                   { return (failedListeners & (1u << chunk.ListenerIndex)) != 0; });
+    }
+    INC_DWORD_STAT_BY(STAT_Acoustics_StreamingProbesRequested, numProbes);
+    if (numProbes > 0)
+    {
+        // The set of loaded probes changed, so results for the same positions may change too
+        m_QueryCache.Reset();
+    }
+}
+
+// Loads one box of a listener's tile. Returns the number of probes Triton will load, or -1 on failure.
+int32 FProjectAcousticsModule::IssueStreamingChunk(const FAcousticStreamingChunk& chunk, const bool releaseStale)
+{
+    auto& tile = m_StreamedTiles[chunk.ListenerIndex];
+    const auto unloadStale = tile.StaleBounds.IsValid && (releaseStale || (chunk.IsFinal && m_UnloadProbesOutsideTile));
+
+    int32 numProbes;
+    if (m_StreamedTiles.Num() == 1)
+    {
+        // The boxes only grow, so unloading outside this one drops just the stale probes. The whole tile also clears
+        // out anything else that was left loaded.
+        const auto unloadOutside = unloadStale || (chunk.IsFinal && m_UnloadProbesOutsideTile);
+        numProbes = LoadTritonRegion(m_Triton, chunk.Region, unloadOutside, false);
+    }
+    else
+    {
+        // Triton cancels unloads of probes that are loaded again right after, so probes that stay inside some
+        // listener's tile cost no IO
+        if (unloadStale)
+        {
+            UnloadTritonBounds(tile.StaleBounds);
+        }
+        numProbes = LoadTritonRegion(m_Triton, chunk.Region, false, false);
+        if (unloadStale)
+        {
+            ReloadStreamedTiles(chunk.ListenerIndex);
+        }
+    }
+
+    if (unloadStale)
+    {
+        tile.StaleBounds = FBox(ForceInit);
+    }
+    if (numProbes >= 0)
+    {
+        tile.LoadedRegion = chunk.Region;
+    }
+    return numProbes;
+}
+
+// Loads what has been streamed in for every listener but one again, which cancels any unloads of those probes
+void FProjectAcousticsModule::ReloadStreamedTiles(const int32 exceptListenerIndex)
+{
+    for (auto i = 0; i < m_StreamedTiles.Num(); i++)
+    {
+        const auto& region = m_StreamedTiles[i].LoadedRegion;
+        if (i != exceptListenerIndex && !region.Size.IsZero())
+        {
+            LoadTritonRegion(m_Triton, region, false, false);
+        }
+    }
+}
+
+// For when the listeners' whole tiles have been loaded in one go
+void FProjectAcousticsModule::ResetStreamedTiles()
+{
+    m_StreamingQueue.Reset();
+    m_StreamedTiles.SetNum(m_LoadedRegions.Num());
+    for (auto i = 0; i < m_LoadedRegions.Num(); i++)
+    {
+        m_StreamedTiles[i].LoadedRegion = m_LoadedRegions[i];
+        m_StreamedTiles[i].StaleBounds = FBox(ForceInit);
+    }
+}
+
+// Unloads the probes of tiles the listeners have left behind. Returns false if there were none.
+bool FProjectAcousticsModule::UnloadStaleTiles()
+{
+    auto hasUnloaded = false;
+    for (auto& tile : m_StreamedTiles)
+    {
+        if (tile.StaleBounds.IsValid)
+        {
+            UnloadTritonBounds(tile.StaleBounds);
+            tile.StaleBounds = FBox(ForceInit);
+            hasUnloaded = true;
+        }
+    }
+    if (hasUnloaded)
+    {
+        // Cancels the unloads of probes that are still in some listener's tile
+        ReloadStreamedTiles(INDEX_NONE);
+    }
+    return hasUnloaded;
+}
+
+// Keeps Triton's memory under PA.MemoryBudgetMB. The budget is checked every frame, also while tiles are streaming in,
+// which is when memory grows. Over it, probes are unloaded a step at a time, giving each step time to get through
+// Triton's queue behind the loads in flight: first the tiles the listeners have left behind, then the listeners' tiles
+// are scaled down towards the listeners, which drops the farthest probes. The scale also applies to tiles loaded
+// later, and grows back once memory is well under the budget.
+// Memory is measured as the bytes Triton asked for. They go down as soon as probes are freed, while pooled blocks are
+// rounded up to their size class and slabs are kept for reuse, so neither would show an unload in full.
+void FProjectAcousticsModule::EnforceMemoryBudget()
+{
+    SET_FLOAT_STAT(STAT_Acoustics_TileEvictionScale, m_TileEvictionScale);
+    if (c_MemoryBudgetMB <= 0)
+    {
+        m_TileEvictionScale = 1.0f;
+        return;
+    }
+    if (!m_AceFileLoaded)
+    {
+        return;
+    }
+
+    const auto now = FPlatformTime::Seconds();
+    const auto budgetBytes = static_cast<int64>(c_MemoryBudgetMB) * 1024 * 1024;
+    const auto memoryUsed = m_TritonMemHook->GetTotalMemoryRequested();
+    if (memoryUsed <= budgetBytes)
+    {
+        if (m_TileEvictionScale < 1.0f && memoryUsed < budgetBytes * c_EvictionRecoveryFraction &&
+            now - m_LastEvictionTime > c_EvictionRecoverySeconds)
+        {
+            m_TileEvictionScale = FMath::Min(m_TileEvictionScale / c_EvictionTileScaleStep, 1.0f);
+            m_LastEvictionTime = now;
+        }
+        return;
+    }
+    if (now - m_LastEvictionTime < c_EvictionStepSeconds)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadRegion);
+    if (UnloadStaleTiles())
+    {
+        INC_DWORD_STAT(STAT_Acoustics_Evictions);
+        m_NumEvictions.Add(1);
+        m_LastEvictionTime = now;
+        return;
+    }
+    if (m_TileEvictionScale <= c_MinEvictionTileScale || m_LoadedRegions.Num() != m_TileListenerPositions.Num())
     {
+        // Nothing left that can go
         return;
     }
 
-    const auto difference = (playerPosition - m_LastLoadCenterPosition).GetAbs();
-    const auto loadThreshold = m_LastLoadTileSize * c_AceTileLoadMargin * 0.5f;
-    bool shouldUpdate = forceUpdate || (difference.X > loadThreshold.X || difference.Y > loadThreshold.Y ||
-                                        difference.Z > loadThreshold.Z);
-    if (shouldUpdate)
+    const auto previousScale = m_TileEvictionScale;
+    m_TileEvictionScale = FMath::Max(m_TileEvictionScale * c_EvictionTileScaleStep, c_MinEvictionTileScale);
+    const auto shrink = m_TileEvictionScale / previousScale;
+    UE_LOG(
+        LogAcousticsRuntime, Verbose, TEXT("Acoustics memory [%lld]KB over budget, scaling tiles down to [%d%%]"),
+        (memoryUsed - budgetBytes) >> 10, static_cast<int32>(m_TileEvictionScale * 100.0f));
+
+    // Shrinking towards the listener keeps it at the same spot relative to its tile, so the tile isn't reloaded any
+    // sooner than before
+    auto regions = m_LoadedRegions;
+    for (auto i = 0; i < regions.Num(); i++)
+    {
+        regions[i].Center = FMath::Lerp(m_TileListenerPositions[i], regions[i].Center, shrink);
+        regions[i].Size *= shrink;
+    }
+    for (const auto& region : m_LoadedRegions)
+    {
+        if (!region.Size.IsZero())
+        {
+            UnloadTritonBounds(FBox::BuildAABB(region.Center, region.Size * 0.5f));
+        }
+    }
+    // Cancels the unloads of probes that are still in some listener's smaller tile
+    for (const auto& region : regions)
     {
-        int loadedProbes = 0;
+        if (!region.Size.IsZero())
         {
-            SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadRegion);
-            loadedProbes = m_Triton->LoadRegion(
-                AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(playerPosition)),
-                AcousticsUtils::ToTritonVectorDouble(WorldScaleToTriton(tileSize).GetAbs()),
-                unloadProbesOutsideTile,
-                blockOnCompletion);
+            LoadTritonRegion(m_Triton, region, false, false);
         }
-        if (loadedProbes >= 0)
+    }
+    m_LoadedRegions = MoveTemp(regions);
+    ResetStreamedTiles();
+    m_QueryCache.Reset();
+    INC_DWORD_STAT(STAT_Acoustics_Evictions);
+    m_NumEvictions.Add(1);
+    m_LastEvictionTime = now;
+}
+
+// Starts a new stats window on a newly loaded instance. Triton ignores this before InitLoad.
+void FProjectAcousticsModule::RestartTritonStats()
+{
+    m_HasTritonStats = false;
+    m_LastTritonStatsTime = FPlatformTime::Seconds();
+    if (c_TritonStatsInterval > 0.0f)
+    {
+        m_Triton->StartCollectingStats();
+    }
+}
+
+// Collects the stats Triton gathered over the last window and starts the next one. Window totals go to accumulators
+// and traces when collected, the latest window is shown on every frame until the next one.
+void FProjectAcousticsModule::UpdateTritonStats()
+{
+    if (!m_AceFileLoaded || c_TritonStatsInterval <= 0.0f)
+    {
+        m_HasTritonStats = false;
+        return;
+    }
+
+    const auto now = FPlatformTime::Seconds();
+    if (now - m_LastTritonStatsTime >= c_TritonStatsInterval)
+    {
+        TritonStats stats;
+        if (m_Triton->GetPerfStats(stats))
         {
-            m_LastLoadCenterPosition = playerPosition;
-            // Tile Size must be all positive values, otherwise triton fails to load probes
-            m_LastLoadTileSize = tileSize.GetAbs();
+            m_TritonStats = stats;
+            m_HasTritonStats = true;
+
+            INC_DWORD_STAT_BY(STAT_Acoustics_TritonProbesLoaded, stats.ProbesLoaded);
+            INC_DWORD_STAT_BY(STAT_Acoustics_TritonProbesLoadFailed, stats.ProbesLoadFailed);
+            INC_DWORD_STAT_BY(STAT_Acoustics_TritonProbesUnloaded, stats.ProbesUnloaded);
+            INC_DWORD_STAT_BY(STAT_Acoustics_TritonFailedQueries, stats.NumFailed);
+            INC_DWORD_STAT_BY(STAT_Acoustics_TritonStreamingFailures, stats.NumStreamingFailed);
+
+            TRACE_COUNTER_SET(Acoustics_TritonProbesInRAM, stats.ProbesInRAM);
+            TRACE_COUNTER_SET(Acoustics_TritonProbesPendingLoad, stats.ProbesPendingLoad);
+            TRACE_COUNTER_SET(Acoustics_TritonProbesLoaded, stats.ProbesLoaded);
+            TRACE_COUNTER_SET(Acoustics_TritonProbesLoadFailed, stats.ProbesLoadFailed);
+            TRACE_COUNTER_SET(Acoustics_TritonFailedQueries, stats.NumFailed);
+            TRACE_COUNTER_SET(Acoustics_TritonAvgQueryTime, stats.AvgQueryTime);
+            TRACE_COUNTER_SET(Acoustics_TritonMaxQueryTime, stats.MaxQueryTime);
         }
+        m_Triton->StartCollectingStats();
+        m_LastTritonStatsTime = now;
+    }
+
+    if (m_HasTritonStats)
+    {
+        SET_DWORD_STAT(STAT_Acoustics_TritonProbesInRAM, m_TritonStats.ProbesInRAM);
+        SET_DWORD_STAT(STAT_Acoustics_TritonProbesPendingLoad, m_TritonStats.ProbesPendingLoad);
+        SET_DWORD_STAT(STAT_Acoustics_TritonProbesPendingUnload, m_TritonStats.ProbesPendingUnload);
+        SET_FLOAT_STAT(STAT_Acoustics_TritonAvgQueryTime, m_TritonStats.AvgQueryTime);
+        SET_FLOAT_STAT(STAT_Acoustics_TritonMaxQueryTime, m_TritonStats.MaxQueryTime);
+        SET_FLOAT_STAT(STAT_Acoustics_TritonStdDevQueryTime, m_TritonStats.StdDevQueryTime);
+    }
+}
+
+// Includes reads of files that have been closed since, and of files loading for a hot-swap
+int64 FProjectAcousticsModule::GetTotalBytesRead() const
+{
+    return FTritonUnrealIOHook::GetBytesReadByAllFiles();
+}
+
+FAcousticsTelemetry FProjectAcousticsModule::GetTelemetry() const
+{
+    FAcousticsTelemetry telemetry;
+    if (m_TritonMemHook != nullptr)
+    {
+        telemetry.MemoryUsed = m_TritonMemHook->GetTotalMemoryUsed();
+        telemetry.MemoryReserved = m_TritonMemHook->GetTotalMemoryReserved();
+        telemetry.MemoryHighWaterMark = m_TritonMemHook->GetPeakMemoryReserved();
+        telemetry.FailedAllocations = m_TritonMemHook->GetNumFailedAllocations();
     }
+    telemetry.BytesRead = GetTotalBytesRead();
+    telemetry.TileLoads = m_NumTileLoads.Get();
+    telemetry.FailedTileLoads = m_NumFailedTileLoads.Get();
+    telemetry.ProbesRequested = m_NumProbesRequested.Get();
+    telemetry.Evictions = m_NumEvictions.Get();
+    telemetry.Queries = m_NumQueries.Get();
+    telemetry.FailedQueries = m_NumFailedQueries.Get();
+    return telemetry;
 }
 
 FVector FProjectAcousticsModule::TritonPositionToWorld(const FVector& vec) const
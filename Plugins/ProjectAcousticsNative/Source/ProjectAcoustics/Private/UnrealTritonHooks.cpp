@@ -3,12 +3,21 @@
 
 #include "UnrealTritonHooks.h"
 #include "IAcoustics.h"
+#include "AcousticsTraceEvents.h"
 #include "Async/Async.h"
 #include "HAL/PlatformFilemanager.h"
 #include "HAL/FileManager.h"
+#include "Runtime/Launch/Resources/Version.h"
 
 DEFINE_STAT(STAT_Acoustics_Memory);
+DEFINE_STAT(STAT_Acoustics_MemoryReserved);
+DEFINE_STAT(STAT_Acoustics_FailedAllocations);
 DEFINE_STAT(STAT_Acoustics_FileReads);
+DEFINE_STAT(STAT_Acoustics_ReadCacheHits);
+DEFINE_STAT(STAT_Acoustics_ReadCacheMisses);
+DEFINE_STAT(STAT_Acoustics_ReadAheadBytes);
+DEFINE_STAT(STAT_Acoustics_StreamingTask);
+DEFINE_STAT(STAT_Acoustics_StreamingQueueTime);
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// LOG HOOK
@@ -61,115 +70,614 @@ namespace TritonRuntime
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
     // NOTE: All the memory hook functions below must be thread-safe
 
-    inline void* FTritonMemHook::Malloc(size_t inSize)
+    // Sits in front of every block handed to Triton. Its size keeps the payload 16 byte aligned.
+    struct FTritonMemHook::FBlockHeader
     {
-        void* outPtr = FMemory::Malloc(inSize, 16);
+        // Usable bytes in the block
+        uint64 Capacity;
+        // Bytes Triton asked for. Only kept for pooled blocks, large ones are exactly the size asked for.
+        uint32 RequestedSize;
+        uint16 SizeClass;
+        uint16 Scope;
+    };
+    static_assert(sizeof(FTritonMemHook::FBlockHeader) == 16, "Block payloads must stay 16 byte aligned");
 
-#if !UE_BUILD_SHIPPING
-        // Allocated block size can be larger than requested, get the actual size.
-        // (Note that this deals with nullptr correctly)
-        auto allocSize = FMemory::GetAllocSize(outPtr);
-        INC_MEMORY_STAT_BY(STAT_Acoustics_Memory, allocSize);
-        FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, static_cast<int64>(allocSize));
-#endif //! UE_BUILD_SHIPPING
+    // Size class of blocks that don't come from a pool
+    static constexpr uint16 c_LargeSizeClass = 0xFFFF;
+    // Pools grow by about this many bytes at a time
+    static constexpr uint64 c_SlabBytes = 64 * 1024;
 
-        return outPtr;
+    // Sizes up to 16 bytes are class 0. Above that, classes alternate between powers of two and 1.5 times a power of
+    // two, so no more than a third of a block goes unused. Classes past the last pool are large.
+    static int32 GetSizeClass(const uint64 size)
+    {
+        if (size <= 16)
+        {
+            return 0;
+        }
+        // 2^power < size <= 2^(power + 1)
+        const auto power = static_cast<int32>(FMath::FloorLog2_64(size - 1));
+        return size <= (3ull << (power - 1)) ? 2 * (power - 4) + 1 : 2 * (power - 3);
     }
 
-    void* FTritonMemHook::Realloc(void* inPtr, size_t size)
+    static uint64 GetSizeClassBytes(const int32 sizeClass)
     {
-#if !UE_BUILD_SHIPPING
-        int64 oldSize = FMemory::GetAllocSize(inPtr);
-#endif
+        const auto power = 4 + sizeClass / 2;
+        return sizeClass % 2 == 0 ? 1ull << power : 3ull << (power - 1);
+    }
 
-        void* outPtr = FMemory::Realloc(inPtr, size, 16);
+    // Rounded up so that every block in a slab keeps its payload 16 byte aligned, which the 24 byte class would not
+    static uint64 GetBlockStride(const int32 sizeClass)
+    {
+        return Align(sizeof(FTritonMemHook::FBlockHeader) + GetSizeClassBytes(sizeClass), 16);
+    }
 
-#if !UE_BUILD_SHIPPING
-        int64 newSize = FMemory::GetAllocSize(outPtr);
+    static uint64 GetSlabBytes(const int32 sizeClass)
+    {
+        const auto blockStride = GetBlockStride(sizeClass);
+        return blockStride * FMath::Max<uint64>(c_SlabBytes / blockStride, 1);
+    }
+
+    // Pooled blocks are 16 byte aligned and sit below 2^48, so the head of a free list packs the block address into
+    // the low 44 bits and leaves the top 20 bits for the tag
+    static constexpr int32 c_FreeHeadTagShift = 44;
+    static constexpr uint64 c_FreeHeadBlockMask = (1ull << c_FreeHeadTagShift) - 1;
+
+    static int64 PackFreeHead(const FTritonMemHook::FBlockHeader* block, const uint64 tag)
+    {
+        return static_cast<int64>((tag << c_FreeHeadTagShift) | (reinterpret_cast<UPTRINT>(block) >> 4));
+    }
+
+    static FTritonMemHook::FBlockHeader* GetFreeHeadBlock(const int64 head)
+    {
+        return reinterpret_cast<FTritonMemHook::FBlockHeader*>(
+            static_cast<UPTRINT>((static_cast<uint64>(head) & c_FreeHeadBlockMask) << 4));
+    }
 
-        // Increment counters if new size is larger, decrement otherwise
-        if (newSize > oldSize)
+    static uint64 GetFreeHeadTag(const int64 head)
+    {
+        return static_cast<uint64>(head) >> c_FreeHeadTagShift;
+    }
+
+    // A free block links to the next free block through the first bytes of its payload
+    static volatile int64* GetFreeLink(FTritonMemHook::FBlockHeader* block)
+    {
+        return reinterpret_cast<volatile int64*>(block + 1);
+    }
+
+    static void SetNextFreeBlock(FTritonMemHook::FBlockHeader* block, const FTritonMemHook::FBlockHeader* next)
+    {
+        FPlatformAtomics::AtomicStore(GetFreeLink(block), static_cast<int64>(reinterpret_cast<UPTRINT>(next)));
+    }
+
+    // The allocation scopes Triton has opened on this thread, innermost last
+    struct FAllocationScopeStack
+    {
+        static constexpr int32 c_MaxDepth = 8;
+        uint16 Scopes[c_MaxDepth];
+        int32 Depth = 0;
+    };
+    static thread_local FAllocationScopeStack s_AllocationScopes;
+
+    static uint16 GetCurrentAllocationScope()
+    {
+        const auto& stack = s_AllocationScopes;
+        return stack.Depth > 0 ? stack.Scopes[FMath::Min(stack.Depth, FAllocationScopeStack::c_MaxDepth) - 1] : 0;
+    }
+
+    static bool IsScopeName(const FString& name, const wchar_t* scopeName)
+    {
+        auto i = 0;
+        for (; scopeName[i] != 0; i++)
         {
-            INC_MEMORY_STAT_BY(STAT_Acoustics_Memory, newSize - oldSize);
-            FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, static_cast<int64>(newSize - oldSize));
+            if (i >= name.Len() || name[i] != static_cast<TCHAR>(scopeName[i]))
+            {
+                return false;
+            }
         }
-        else
+        return i == name.Len();
+    }
+
+    FTritonMemHook::FTritonMemHook(const bool usePools)
+        : m_UsePools(usePools)
+        , m_TotalMemoryReserved(0)
+        , m_PeakMemoryReserved(0)
+        , m_NumFailedAllocations(0)
+        , m_BudgetBytes(0)
+        , m_NumScopes(1)
+    {
+        m_ScopeKeys[0] = nullptr;
+        m_ScopeNames[0] = TEXT("Unscoped");
+    }
+
+    FTritonMemHook::~FTritonMemHook()
+    {
+        // Triton has been torn down by now. If it still holds blocks, the slabs are leaked rather than pulled out from
+        // under it.
+        const auto memoryUsed = m_TotalMemoryUsed.Get();
+        if (memoryUsed != 0)
+        {
+            UE_LOG(
+                LogAcousticsRuntime, Warning, TEXT("Triton still holds %lld bytes at shutdown, leaking its memory pools"),
+                memoryUsed);
+            return;
+        }
+
+        for (auto sizeClass = 0; sizeClass < c_NumSizeClasses; sizeClass++)
         {
-            DEC_MEMORY_STAT_BY(STAT_Acoustics_Memory, oldSize - newSize);
-            FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, -static_cast<int64>(oldSize - newSize));
+            for (auto slab : m_Pools[sizeClass].Slabs)
+            {
+                FMemory::Free(slab);
+                ReleaseMemory(GetSlabBytes(sizeClass));
+            }
         }
-#endif //! UE_BUILD_SHIPPING
+    }
 
+    void* FTritonMemHook::Malloc(size_t inSize)
+    {
+        const auto sizeClass = GetSizeClass(inSize);
+        if (m_UsePools && sizeClass < c_NumSizeClasses)
+        {
+            return AllocateBlock(sizeClass, inSize);
+        }
+
+        if (!ReserveMemory(sizeof(FBlockHeader) + inSize))
+        {
+            return nullptr;
+        }
+        auto header = static_cast<FBlockHeader*>(FMemory::Malloc(sizeof(FBlockHeader) + inSize, 16));
+        header->Capacity = inSize;
+        header->RequestedSize = 0;
+        header->SizeClass = c_LargeSizeClass;
+        header->Scope = GetCurrentAllocationScope();
+        CountBlock(header, 1);
+        return header + 1;
+    }
+
+    void* FTritonMemHook::Realloc(void* inPtr, size_t size)
+    {
+        if (inPtr == nullptr)
+        {
+            return Malloc(size);
+        }
+        if (size == 0)
+        {
+            Free(inPtr);
+            return nullptr;
+        }
+
+        auto header = static_cast<FBlockHeader*>(inPtr) - 1;
+        const auto sizeClass = GetSizeClass(size);
+        if (header->SizeClass != c_LargeSizeClass)
+        {
+            if (sizeClass == header->SizeClass)
+            {
+                // Still fits the block
+                m_TotalMemoryRequested.Add(static_cast<int64>(size) - static_cast<int64>(header->RequestedSize));
+                header->RequestedSize = static_cast<uint32>(size);
+                return inPtr;
+            }
+        }
+        else if (!m_UsePools || sizeClass >= c_NumSizeClasses)
+        {
+            // Large blocks stay large, and the engine allocator can often resize them in place
+            const auto sizeChange = static_cast<int64>(size) - static_cast<int64>(header->Capacity);
+            if (sizeChange > 0 && !ReserveMemory(sizeChange))
+            {
+                return nullptr;
+            }
+            CountBlock(header, -1);
+            header = static_cast<FBlockHeader*>(FMemory::Realloc(header, sizeof(FBlockHeader) + size, 16));
+            header->Capacity = size;
+            CountBlock(header, 1);
+            if (sizeChange < 0)
+            {
+                ReleaseMemory(-sizeChange);
+            }
+            return header + 1;
+        }
+
+        // Moving to another pool, or between a pool and the engine allocator
+        auto outPtr = Malloc(size);
+        if (outPtr != nullptr)
+        {
+            FMemory::Memcpy(outPtr, inPtr, FMath::Min<uint64>(size, header->Capacity));
+            Free(inPtr);
+        }
         return outPtr;
     }
 
     void FTritonMemHook::Free(void* inPtr)
     {
-#if !UE_BUILD_SHIPPING
-        // note that this deals will nullptr correctly
-        auto AllocSize = FMemory::GetAllocSize(inPtr);
-        DEC_MEMORY_STAT_BY(STAT_Acoustics_Memory, AllocSize);
-        FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, -static_cast<int64>(AllocSize));
-#endif //! UE_BUILD_SHIPPING
+        if (inPtr == nullptr)
+        {
+            return;
+        }
+
+        auto header = static_cast<FBlockHeader*>(inPtr) - 1;
+        CountBlock(header, -1);
+        if (header->SizeClass == c_LargeSizeClass)
+        {
+            ReleaseMemory(sizeof(FBlockHeader) + header->Capacity);
+            FMemory::Free(header);
+        }
+        else
+        {
+            FreeBlock(header);
+        }
+    }
+
+    void FTritonMemHook::StartAllocationScope(const wchar_t* scopeName)
+    {
+        auto& stack = s_AllocationScopes;
+        if (stack.Depth < FAllocationScopeStack::c_MaxDepth)
+        {
+            stack.Scopes[stack.Depth] = FindOrAddScope(scopeName);
+        }
+        // Scopes nested too deep are counted against the deepest one that fits
+        stack.Depth++;
+    }
 
-        FMemory::Free(inPtr);
+    void FTritonMemHook::StopAllocationScope(const wchar_t* scopeName)
+    {
+        auto& stack = s_AllocationScopes;
+        if (stack.Depth > 0)
+        {
+            stack.Depth--;
+        }
     }
 
-    FTritonMemHook::FTritonMemHook() : m_TotalMemoryUsed(0)
+    void FTritonMemHook::SetBudget(const int64 budgetBytes)
     {
+        FPlatformAtomics::AtomicStore(&m_BudgetBytes, FMath::Max<int64>(budgetBytes, 0));
     }
 
     int64 FTritonMemHook::GetTotalMemoryUsed() const
     {
-        return m_TotalMemoryUsed;
+        return m_TotalMemoryUsed.Get();
+    }
+
+    int64 FTritonMemHook::GetTotalMemoryReserved() const
+    {
+        return m_TotalMemoryReserved;
+    }
+
+    int64 FTritonMemHook::GetPeakMemoryReserved() const
+    {
+        return FPlatformAtomics::AtomicRead(&m_PeakMemoryReserved);
+    }
+
+    int64 FTritonMemHook::GetTotalMemoryRequested() const
+    {
+        return m_TotalMemoryRequested.Get();
+    }
+
+    int64 FTritonMemHook::GetNumFailedAllocations() const
+    {
+        return m_NumFailedAllocations;
+    }
+
+    void FTritonMemHook::GetScopeMemory(TArray<FScopeMemory>& outScopes) const
+    {
+        const auto numScopes = FPlatformAtomics::AtomicRead(&m_NumScopes);
+        outScopes.Reset(numScopes);
+        for (auto i = 0; i < numScopes; i++)
+        {
+            outScopes.Add({m_ScopeNames[i], m_ScopeBytesUsed[i].Get()});
+        }
+    }
+
+    void* FTritonMemHook::AllocateBlock(const int32 sizeClass, const uint64 requestedSize)
+    {
+        auto& pool = m_Pools[sizeClass];
+        auto header = PopFreeBlock(pool);
+        if (header == nullptr)
+        {
+            FScopeLock lock(&pool.GrowLock);
+            // Another thread may have grown the pool while this one waited
+            header = PopFreeBlock(pool);
+            if (header == nullptr)
+            {
+                // Carve a new slab into blocks, keeping the first one and freeing the rest in one go
+                const auto slabBytes = GetSlabBytes(sizeClass);
+                if (!ReserveMemory(slabBytes))
+                {
+                    return nullptr;
+                }
+                auto slab = static_cast<uint8*>(FMemory::Malloc(slabBytes, 16));
+                check(reinterpret_cast<UPTRINT>(slab) + slabBytes <= (1ull << (c_FreeHeadTagShift + 4)));
+                pool.Slabs.Add(slab);
+
+                const auto blockStride = GetBlockStride(sizeClass);
+                FBlockHeader* lastBlock = nullptr;
+                for (auto offset = 0ull; offset + blockStride <= slabBytes; offset += blockStride)
+                {
+                    auto block = reinterpret_cast<FBlockHeader*>(slab + offset);
+                    block->Capacity = GetSizeClassBytes(sizeClass);
+                    block->SizeClass = static_cast<uint16>(sizeClass);
+                    if (header == nullptr)
+                    {
+                        header = block;
+                        continue;
+                    }
+                    if (lastBlock != nullptr)
+                    {
+                        SetNextFreeBlock(lastBlock, block);
+                    }
+                    lastBlock = block;
+                }
+                if (lastBlock != nullptr)
+                {
+                    PushFreeBlocks(pool, reinterpret_cast<FBlockHeader*>(slab + blockStride), lastBlock);
+                }
+            }
+        }
+
+        header->RequestedSize = static_cast<uint32>(requestedSize);
+        header->Scope = GetCurrentAllocationScope();
+        CountBlock(header, 1);
+        return header + 1;
+    }
+
+    void FTritonMemHook::FreeBlock(FBlockHeader* header)
+    {
+        PushFreeBlocks(m_Pools[header->SizeClass], header, header);
+    }
+
+    FTritonMemHook::FBlockHeader* FTritonMemHook::PopFreeBlock(FSizeClassPool& pool)
+    {
+        auto head = FPlatformAtomics::AtomicRead(&pool.FreeHead);
+        while (true)
+        {
+            auto block = GetFreeHeadBlock(head);
+            if (block == nullptr)
+            {
+                return nullptr;
+            }
+
+            // Another thread may take the block and write to it before the exchange below. The link read then is
+            // garbage, but the tag has moved on and the exchange fails. The slab itself stays valid.
+            const auto next = reinterpret_cast<FBlockHeader*>(
+                static_cast<UPTRINT>(FPlatformAtomics::AtomicRead(GetFreeLink(block))));
+            const auto newHead = PackFreeHead(next, GetFreeHeadTag(head) + 1);
+            const auto previousHead = FPlatformAtomics::InterlockedCompareExchange(&pool.FreeHead, newHead, head);
+            if (previousHead == head)
+            {
+                return block;
+            }
+            head = previousHead;
+        }
+    }
+
+    // Pushes the free blocks first to last, which are already linked together
+    void FTritonMemHook::PushFreeBlocks(FSizeClassPool& pool, FBlockHeader* first, FBlockHeader* last)
+    {
+        auto head = FPlatformAtomics::AtomicRead(&pool.FreeHead);
+        while (true)
+        {
+            SetNextFreeBlock(last, GetFreeHeadBlock(head));
+            const auto newHead = PackFreeHead(first, GetFreeHeadTag(head) + 1);
+            const auto previousHead = FPlatformAtomics::InterlockedCompareExchange(&pool.FreeHead, newHead, head);
+            if (previousHead == head)
+            {
+                return;
+            }
+            head = previousHead;
+        }
+    }
+
+    bool FTritonMemHook::ReserveMemory(const int64 bytes)
+    {
+        const auto budget = FPlatformAtomics::AtomicRead(&m_BudgetBytes);
+        const auto reserved = FPlatformAtomics::InterlockedAdd(&m_TotalMemoryReserved, bytes) + bytes;
+        if (budget > 0 && reserved > budget)
+        {
+            FPlatformAtomics::InterlockedAdd(&m_TotalMemoryReserved, -bytes);
+            FPlatformAtomics::InterlockedIncrement(&m_NumFailedAllocations);
+            INC_DWORD_STAT(STAT_Acoustics_FailedAllocations);
+            return false;
+        }
+        INC_MEMORY_STAT_BY(STAT_Acoustics_MemoryReserved, bytes);
+
+        // Memory is only ever reserved here, so this catches every peak, even one that comes and goes within a frame
+        auto peak = FPlatformAtomics::AtomicRead(&m_PeakMemoryReserved);
+        while (reserved > peak)
+        {
+            const auto previousPeak =
+                FPlatformAtomics::InterlockedCompareExchange(&m_PeakMemoryReserved, reserved, peak);
+            if (previousPeak == peak)
+            {
+                break;
+            }
+            peak = previousPeak;
+        }
+        return true;
+    }
+
+    void FTritonMemHook::ReleaseMemory(const int64 bytes)
+    {
+        FPlatformAtomics::InterlockedAdd(&m_TotalMemoryReserved, -bytes);
+        DEC_MEMORY_STAT_BY(STAT_Acoustics_MemoryReserved, bytes);
+    }
+
+    // Adds the block to the memory in use for sign 1, takes it away for sign -1
+    void FTritonMemHook::CountBlock(const FBlockHeader* header, const int64 sign)
+    {
+        const auto capacity = static_cast<int64>(header->Capacity);
+        const auto requested =
+            header->SizeClass == c_LargeSizeClass ? capacity : static_cast<int64>(header->RequestedSize);
+        m_TotalMemoryUsed.Add(sign * capacity);
+        m_TotalMemoryRequested.Add(sign * requested);
+        m_ScopeBytesUsed[header->Scope].Add(sign * capacity);
+        if (sign > 0)
+        {
+            INC_MEMORY_STAT_BY(STAT_Acoustics_Memory, capacity);
+        }
+        else
+        {
+            DEC_MEMORY_STAT_BY(STAT_Acoustics_Memory, capacity);
+        }
+    }
+
+    uint16 FTritonMemHook::FindOrAddScope(const wchar_t* scopeName)
+    {
+        if (scopeName == nullptr)
+        {
+            return 0;
+        }
+
+        // Triton opens scopes with the same few name strings over and over, so a scope is found by the name pointer it
+        // was added with, without taking the lock. The name is still compared, in case the pointer has been reused for
+        // another name. Scopes are never removed and are published by the count, so the ones below it can be read.
+        auto numScopes = FPlatformAtomics::AtomicRead(&m_NumScopes);
+        for (auto i = 1; i < numScopes; i++)
+        {
+            if (m_ScopeKeys[i] == scopeName && IsScopeName(m_ScopeNames[i], scopeName))
+            {
+                return static_cast<uint16>(i);
+            }
+        }
+
+        FScopeLock lock(&m_ScopeLock);
+        numScopes = m_NumScopes;
+        for (auto i = 1; i < numScopes; i++)
+        {
+            if (IsScopeName(m_ScopeNames[i], scopeName))
+            {
+                return static_cast<uint16>(i);
+            }
+        }
+        if (numScopes == c_MaxScopes)
+        {
+            return 0;
+        }
+
+        m_ScopeKeys[numScopes] = scopeName;
+        auto& name = m_ScopeNames[numScopes];
+        for (auto c = scopeName; *c != 0; c++)
+        {
+            name.AppendChar(static_cast<TCHAR>(*c));
+        }
+        FPlatformAtomics::AtomicStore(&m_NumScopes, numScopes + 1);
+        return static_cast<uint16>(numScopes);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// IO HOOK
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
-    // Read block size
-    const size_t FTritonUnrealIOHook::m_ReadCacheSize = 4 * 1024 * 1024;
+    // Kept in all builds for telemetry. Files are read from many threads, and closed files still count.
+    static FAcousticsShardedCounter s_BytesReadByAllFiles;
+    // Lets traces attribute reads to the streaming task or tile load that made them
+    static thread_local int64 s_BytesReadOnThisThread = 0;
+
+    static void CountBytesRead(const int64 bytes)
+    {
+        s_BytesReadByAllFiles.Add(bytes);
+        s_BytesReadOnThisThread += bytes;
+    }
+
+    // Blocks read in a row, front to back, before reading ahead kicks in
+    constexpr int32 c_SequentialBlocksBeforeReadAhead = 2;
 
     uint64 FCachedSyncDiskReader::_DiskRead(uint64 fileOffset, void* destBuffer, uint64 bytesToRead)
     {
         check(IsOK());
 
-        auto request = TUniquePtr<IAsyncReadRequest>(m_FileHandle->ReadRequest(fileOffset, bytesToRead, AIOP_Normal));
-        if (!request->WaitCompletion())
+        if (bytesToRead == 0)
         {
-            // Something went wrong with loading
-            return -1;
+            return 0;
         }
-        auto result = request->GetReadResults();
 
-        if (result == nullptr)
+        // Large reads are split into block sized requests, with up to m_MaxReadsInFlight of them queued at once so
+        // that the device can work on them in parallel. Requests read straight into the destination, so there is
+        // no intermediate buffer to copy out of and free.
+        auto dest = static_cast<uint8*>(destBuffer);
+        const auto requestSize = bytesToRead > m_BlockSize && m_MaxReadsInFlight > 1 ? m_BlockSize : bytesToRead;
+        const auto numRequests = (bytesToRead + requestSize - 1) / requestSize;
+        const auto queueDepth = FMath::Min<uint64>(numRequests, m_MaxReadsInFlight);
+
+        TArray<TUniquePtr<IAsyncReadRequest>, TInlineAllocator<8>> requests;
+        requests.SetNum(static_cast<int32>(queueDepth));
+        uint64 numIssued = 0;
+        uint64 numCompleted = 0;
+        auto isReadOK = true;
+        auto hasResults = true;
+        while (numCompleted < numIssued || (isReadOK && hasResults && numIssued < numRequests))
         {
-            return 0;
+            // Keep the queue full until a request fails. Outstanding requests must still be waited for, since
+            // they write into the destination.
+            while (isReadOK && hasResults && numIssued < numRequests && numIssued - numCompleted < queueDepth)
+            {
+                const auto offset = numIssued * requestSize;
+                requests[static_cast<int32>(numIssued % queueDepth)].Reset(m_FileHandle->ReadRequest(
+                    fileOffset + offset,
+                    FMath::Min(requestSize, bytesToRead - offset),
+                    AIOP_Normal,
+                    nullptr,
+                    dest + offset));
+                numIssued++;
+            }
+
+            auto& request = requests[static_cast<int32>(numCompleted % queueDepth)];
+            if (!request->WaitCompletion())
+            {
+                // Something went wrong with loading
+                isReadOK = false;
+            }
+            // Ideally, we'd also call GetReadSize() here, but it never returns a valid size even on successful reads
+            else if (request->GetReadResults() == nullptr)
+            {
+                hasResults = false;
+            }
+            request.Reset();
+            numCompleted++;
         }
 
-        // Ideally, we'd also call GetReadSize() here, but it never returns a valid size even on successful reads
-        FMemory::Memcpy(destBuffer, result, bytesToRead);
-        // By contract, we must call free on the result buffer now that we're done with it
-        FMemory::Free(result);
+        if (!isReadOK)
+        {
+            return -1;
+        }
+        if (!hasResults)
+        {
+            return 0;
+        }
 
 #if !UE_BUILD_SHIPPING
         INC_DWORD_STAT_BY(STAT_Acoustics_FileReads, bytesToRead);
-        m_BytesRead += static_cast<int64>(bytesToRead);
 #endif
+        m_BytesRead += static_cast<int64>(bytesToRead);
+        CountBytesRead(static_cast<int64>(bytesToRead));
 
         return bytesToRead;
     }
 
-    FCachedSyncDiskReader::FCachedSyncDiskReader(const FString& fileName, uint64 cacheSize)
-        : m_FileName(fileName), m_CacheSize(cacheSize), m_CacheFileOffset(0), m_IsCacheInvalid(true), m_BytesRead(0)
+    FCachedSyncDiskReader::FCachedSyncDiskReader(
+        const FString& fileName, uint64 blockSize, int32 numCacheBlocks, int32 numReadAheadBlocks,
+        int32 maxReadsInFlight)
+        : m_FileName(fileName)
+        , m_BlockSize(FMath::Max<uint64>(blockSize, 4096))
+        , m_NumReadAheadBlocks(0)
+        , m_MaxReadsInFlight(FMath::Max(maxReadsInFlight, 1))
+        , m_UseCounter(0)
+        , m_LastBlockIndex(INDEX_NONE)
+        , m_NumSequentialBlocks(0)
+        , m_BytesRead(0)
     {
-        m_CacheData.Reserve(cacheSize);
+        // Read-ahead needs blocks of its own on top of the one being read from
+        const auto numBlocks = FMath::Max(numCacheBlocks, 1);
+        m_NumReadAheadBlocks = FMath::Clamp(numReadAheadBlocks, 0, numBlocks - 1);
 
         m_FileSize = IFileManager::Get().FileSize(*fileName);
         // If there were any errors, such as file not found, m_FileSize will be -1
         if (m_FileSize != -1)
         {
             m_FileHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*m_FileName));
+
+            // Small files don't need more blocks than it takes to hold them. Their memory is only allocated once
+            // they are used, see GetBlockData.
+            const auto numFileBlocks = static_cast<int32>(
+                FMath::Min<int64>((m_FileSize + m_BlockSize - 1) / m_BlockSize, numBlocks));
+            m_CacheBlocks.SetNum(FMath::Max(numFileBlocks, 1));
         }
     }
 
@@ -180,8 +688,20 @@ namespace TritonRuntime
 
     FCachedSyncDiskReader::~FCachedSyncDiskReader()
     {
+        // Outstanding read-aheads write into the blocks, they must finish before the blocks go away
+        for (auto& block : m_CacheBlocks)
+        {
+            if (block.PendingRequest.IsValid())
+            {
+                block.PendingRequest->WaitCompletion();
+                block.PendingRequest.Reset();
+            }
+        }
 #if !UE_BUILD_SHIPPING
         SET_DWORD_STAT(STAT_Acoustics_FileReads, 0);
+        SET_DWORD_STAT(STAT_Acoustics_ReadCacheHits, 0);
+        SET_DWORD_STAT(STAT_Acoustics_ReadCacheMisses, 0);
+        SET_DWORD_STAT(STAT_Acoustics_ReadAheadBytes, 0);
 #endif
     }
 
@@ -199,45 +719,173 @@ namespace TritonRuntime
             return 0;
         }
 
-        if (bytesToRead >= m_CacheSize) // big read, bypass cache
+        if (bytesToRead >= m_BlockSize) // big read, bypass cache
         {
             return _DiskRead(readOffset, destBuffer, bytesToRead);
         }
 
-        bool cacheHit;
+        // Small reads touch at most two blocks, copy out of each in turn
+        auto dest = static_cast<uint8*>(destBuffer);
+        uint64 bytesCopied = 0;
+        while (bytesCopied < bytesToRead)
+        {
+            const auto fileOffset = readOffset + bytesCopied;
+            const auto blockIndex = static_cast<int64>(fileOffset / m_BlockSize);
+            const auto block = FindOrReadBlock(blockIndex);
+            if (block == nullptr)
+            {
+                return 0;
+            }
+
+            const auto offsetInBlock = fileOffset - static_cast<uint64>(blockIndex) * m_BlockSize;
+            const auto bytesToCopy = FMath::Min(bytesToRead - bytesCopied, block->Size - offsetInBlock);
+            FMemory::Memcpy(dest + bytesCopied, block->Data.GetData() + offsetInBlock, bytesToCopy);
+            bytesCopied += bytesToCopy;
+        }
 
-        if (m_IsCacheInvalid)
+        return bytesToRead;
+    }
+
+    FCachedSyncDiskReader::FCacheBlock* FCachedSyncDiskReader::FindOrReadBlock(const int64 blockIndex)
+    {
+        // Track whether the file is being walked front to back
+        if (blockIndex == m_LastBlockIndex + 1)
+        {
+            m_NumSequentialBlocks++;
+        }
+        else if (blockIndex != m_LastBlockIndex)
         {
-            cacheHit = false;
+            m_NumSequentialBlocks = 0;
+        }
+        m_LastBlockIndex = blockIndex;
+
+        auto block = FindBlock(blockIndex);
+        if (block != nullptr && block->PendingRequest.IsValid() && !CompletePendingRead(*block))
+        {
+            // Read-ahead failed, read the block again below
+            block = nullptr;
+        }
+
+        if (block != nullptr)
+        {
+#if !UE_BUILD_SHIPPING
+            INC_DWORD_STAT(STAT_Acoustics_ReadCacheHits);
+#endif
         }
         else
         {
-            cacheHit = (readOffset >= m_CacheFileOffset && readOffset + bytesToRead <= m_CacheFileOffset + m_CacheSize);
+#if !UE_BUILD_SHIPPING
+            INC_DWORD_STAT(STAT_Acoustics_ReadCacheMisses);
+#endif
+            block = FindBlockToEvict(true);
+            if (block->PendingRequest.IsValid())
+            {
+                CompletePendingRead(*block);
+            }
+
+            const auto blockSize = GetBlockSize(blockIndex);
+            const auto actuallyRead =
+                _DiskRead(static_cast<uint64>(blockIndex) * m_BlockSize, GetBlockData(*block), blockSize);
+            // Failed read request, block contents are unknown now, invalidate it
+            if (actuallyRead < blockSize)
+            {
+                block->BlockIndex = INDEX_NONE;
+                return nullptr;
+            }
+            block->BlockIndex = blockIndex;
+            block->Size = blockSize;
         }
+        block->LastUsed = ++m_UseCounter;
 
-        if (cacheHit)
+        if (m_NumSequentialBlocks >= c_SequentialBlocksBeforeReadAhead)
         {
-            memcpy(destBuffer, m_CacheData.GetData() + readOffset - m_CacheFileOffset, bytesToRead);
-            return bytesToRead;
+            for (auto i = 1; i <= m_NumReadAheadBlocks; i++)
+            {
+                ReadAhead(blockIndex + i);
+            }
         }
-        else // Cache miss: Update cache and recurse
+
+        return block;
+    }
+
+    FCachedSyncDiskReader::FCacheBlock* FCachedSyncDiskReader::FindBlock(const int64 blockIndex)
+    {
+        return m_CacheBlocks.FindByPredicate([blockIndex](const FCacheBlock& b) { return b.BlockIndex == blockIndex; });
+    }
+
+    FCachedSyncDiskReader::FCacheBlock* FCachedSyncDiskReader::FindBlockToEvict(const bool allowPending)
+    {
+        FCacheBlock* leastRecentlyUsed = nullptr;
+        for (auto& block : m_CacheBlocks)
         {
-            uint64 distToFileEnd = m_FileSize - readOffset;
-            uint64 diskReadSize = FMath::Min(distToFileEnd, static_cast<uint64>(m_CacheSize));
-            uint64 actuallyRead = _DiskRead(readOffset, m_CacheData.GetData(), diskReadSize);
-            // Failed read request, cache contents are unknown now, invalidate it
-            if (actuallyRead < diskReadSize)
+            if (block.BlockIndex == INDEX_NONE)
             {
-                m_IsCacheInvalid = true;
-                return 0;
+                return &block;
+            }
+            if ((allowPending || !block.PendingRequest.IsValid()) &&
+                (leastRecentlyUsed == nullptr || block.LastUsed < leastRecentlyUsed->LastUsed))
+            {
+                leastRecentlyUsed = &block;
             }
+        }
+        return leastRecentlyUsed;
+    }
 
-            m_IsCacheInvalid = false;
-            m_CacheFileOffset = readOffset;
+    bool FCachedSyncDiskReader::CompletePendingRead(FCacheBlock& block)
+    {
+        const auto succeeded =
+            block.PendingRequest->WaitCompletion() && block.PendingRequest->GetReadResults() != nullptr;
+        block.PendingRequest.Reset();
+        if (!succeeded)
+        {
+            block.BlockIndex = INDEX_NONE;
+            return false;
+        }
+
+#if !UE_BUILD_SHIPPING
+        INC_DWORD_STAT_BY(STAT_Acoustics_FileReads, block.Size);
+        INC_DWORD_STAT_BY(STAT_Acoustics_ReadAheadBytes, block.Size);
+#endif
+        m_BytesRead += static_cast<int64>(block.Size);
+        CountBytesRead(static_cast<int64>(block.Size));
+        return true;
+    }
 
-            // recurse, this time cache will be hit
-            return Read(readOffset, destBuffer, bytesToRead);
+    void FCachedSyncDiskReader::ReadAhead(const int64 blockIndex)
+    {
+        if (static_cast<int64>(blockIndex * m_BlockSize) >= m_FileSize || FindBlock(blockIndex) != nullptr)
+        {
+            return;
         }
+
+        // Never wait on another read-ahead to make room for this one, or evict the block being read from
+        auto block = FindBlockToEvict(false);
+        if (block == nullptr || (block->LastUsed == m_UseCounter && block->BlockIndex != INDEX_NONE))
+        {
+            return;
+        }
+
+        block->BlockIndex = blockIndex;
+        block->Size = GetBlockSize(blockIndex);
+        block->LastUsed = m_UseCounter;
+        block->PendingRequest.Reset(m_FileHandle->ReadRequest(
+            static_cast<int64>(blockIndex * m_BlockSize), block->Size, AIOP_Low, nullptr, GetBlockData(*block)));
+    }
+
+    uint64 FCachedSyncDiskReader::GetBlockSize(const int64 blockIndex) const
+    {
+        return FMath::Min(m_BlockSize, static_cast<uint64>(m_FileSize) - static_cast<uint64>(blockIndex) * m_BlockSize);
+    }
+
+    // Empty blocks are the first to be filled, so a file that is only ever read in a few places never allocates the
+    // whole cache
+    uint8* FCachedSyncDiskReader::GetBlockData(FCacheBlock& block)
+    {
+        if (block.Data.Num() == 0)
+        {
+            block.Data.SetNumUninitialized(static_cast<int32>(FMath::Min<int64>(m_BlockSize, m_FileSize)));
+        }
+        return block.Data.GetData();
     }
 
     int64 FCachedSyncDiskReader::GetBytesRead() const
@@ -245,7 +893,86 @@ namespace TritonRuntime
         return m_BytesRead;
     }
 
-    FTritonUnrealIOHook::FTritonUnrealIOHook()
+    FMappedFileReader::FMappedFileReader(const FString& fileName) : m_FileSize(-1), m_BytesRead(0)
+    {
+        auto& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+        auto openResult = platformFile.OpenMappedEx(*fileName);
+        if (openResult.HasValue())
+        {
+            m_MappedHandle = openResult.StealValue();
+        }
+#else
+        m_MappedHandle.Reset(platformFile.OpenMapped(*fileName));
+#endif
+        if (!m_MappedHandle.IsValid())
+        {
+            return;
+        }
+
+        const auto fileSize = m_MappedHandle->GetFileSize();
+        m_MappedRegion.Reset(m_MappedHandle->MapRegion(0, fileSize));
+        if (m_MappedRegion.IsValid() && m_MappedRegion->GetMappedSize() == fileSize)
+        {
+            m_FileSize = fileSize;
+        }
+    }
+
+    FMappedFileReader::~FMappedFileReader()
+    {
+        // The region must be released before the file it maps
+        m_MappedRegion.Reset();
+        m_MappedHandle.Reset();
+#if !UE_BUILD_SHIPPING
+        SET_DWORD_STAT(STAT_Acoustics_FileReads, 0);
+#endif
+    }
+
+    bool FMappedFileReader::IsOK() const
+    {
+        return m_FileSize != -1;
+    }
+
+    int64 FMappedFileReader::GetFileSize() const
+    {
+        return m_FileSize;
+    }
+
+    uint64 FMappedFileReader::Read(uint64 readOffset, void* destBuffer, uint64 bytesToRead)
+    {
+        check(IsOK());
+
+        if (readOffset + bytesToRead > static_cast<uint64>(m_FileSize)) // Reading past EOF
+        {
+            return 0;
+        }
+
+        // Pages are faulted in by the OS as they are touched, straight into Triton's buffer
+        FMemory::Memcpy(destBuffer, m_MappedRegion->GetMappedPtr() + readOffset, bytesToRead);
+
+#if !UE_BUILD_SHIPPING
+        INC_DWORD_STAT_BY(STAT_Acoustics_FileReads, bytesToRead);
+#endif
+        m_BytesRead += static_cast<int64>(bytesToRead);
+        CountBytesRead(static_cast<int64>(bytesToRead));
+
+        return bytesToRead;
+    }
+
+    int64 FMappedFileReader::GetBytesRead() const
+    {
+        return m_BytesRead;
+    }
+
+    FTritonUnrealIOHook::FTritonUnrealIOHook(
+        const bool useMemoryMapping, const uint64 readBlockSize, const int32 numReadCacheBlocks,
+        const int32 numReadAheadBlocks, const int32 maxReadsInFlight)
+        : m_FileOffset(0)
+        , m_UseMemoryMapping(useMemoryMapping)
+        , m_ReadBlockSize(readBlockSize)
+        , m_NumReadCacheBlocks(numReadCacheBlocks)
+        , m_NumReadAheadBlocks(numReadAheadBlocks)
+        , m_MaxReadsInFlight(maxReadsInFlight)
     {
     }
 
@@ -257,7 +984,23 @@ namespace TritonRuntime
     bool FTritonUnrealIOHook::OpenForRead(const char* name)
     {
         m_FileOffset = 0;
-        m_DiskReader = TUniquePtr<FCachedSyncDiskReader>(new FCachedSyncDiskReader(FString(name), m_ReadCacheSize));
+        if (m_UseMemoryMapping)
+        {
+            m_DiskReader = MakeUnique<FMappedFileReader>(FString(name));
+            if (m_DiskReader->IsOK())
+            {
+                return true;
+            }
+
+            // Files inside PAK files and some platforms can't be mapped, read those from disk instead
+            UE_LOG(
+                LogAcousticsRuntime,
+                Log,
+                TEXT("ACE file [%s] can't be memory mapped, falling back to cached disk reads"),
+                ANSI_TO_TCHAR(name));
+        }
+        m_DiskReader = MakeUnique<FCachedSyncDiskReader>(
+            FString(name), m_ReadBlockSize, m_NumReadCacheBlocks, m_NumReadAheadBlocks, m_MaxReadsInFlight);
         return m_DiskReader->IsOK();
     }
 
@@ -283,6 +1026,11 @@ namespace TritonRuntime
         return true;
     }
 
+    bool FTritonUnrealIOHook::IsOpen() const
+    {
+        return m_DiskReader != nullptr && m_DiskReader->IsOK();
+    }
+
     int64 FTritonUnrealIOHook::GetFileSize() const
     {
         return m_DiskReader->GetFileSize();
@@ -300,22 +1048,56 @@ namespace TritonRuntime
         return m_DiskReader != nullptr ? m_DiskReader->GetBytesRead() : 0;
     }
 
+    int64 FTritonUnrealIOHook::GetBytesReadByAllFiles()
+    {
+        return s_BytesReadByAllFiles.Get();
+    }
+
+    int64 FTritonUnrealIOHook::GetBytesReadOnThisThread()
+    {
+        return s_BytesReadOnThisThread;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// TASK HOOK
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // One launch of a Triton streaming task. Owns its copy of the task, and deletes itself once it has run or been
+    // abandoned.
     class FTritonLoadAsyncTask : public IQueuedWork
     {
     public:
-        FTritonLoadAsyncTask(TFunction<void()>&& inFunction, volatile int32* inDoneCounter)
-            : m_Function(inFunction), m_DoneCounter(inDoneCounter)
+        FTritonLoadAsyncTask(TaskFunc* inTask, const uint32 inTaskId, FAcousticsTaskCounter* inDoneCounter)
+            : m_Task(inTask)
+            , m_TaskId(inTaskId)
+            , m_QueueCycles(FPlatformTime::Cycles64())
+            , m_DoneCounter(inDoneCounter)
         {
         }
 
         virtual void DoThreadedWork() override
         {
-            SCOPED_NAMED_EVENT_TEXT("Triton Streaming", FColor::Green);
-            m_Function();
-            FPlatformAtomics::InterlockedDecrement(m_DoneCounter);
+            // The time spent in the queue is part of the event name, so waits for a free streaming thread show up in
+            // captures next to the time spent loading
+            const auto startCycles = FPlatformTime::Cycles64();
+            const auto queuedMs = FPlatformTime::ToMilliseconds64(startCycles - m_QueueCycles);
+            const auto startBytesRead = FTritonUnrealIOHook::GetBytesReadOnThisThread();
+            {
+                SCOPED_NAMED_EVENT_F(TEXT("Triton Streaming %u (queued %.2f ms)"), FColor::Green, m_TaskId, queuedMs);
+                SCOPE_CYCLE_COUNTER(STAT_Acoustics_StreamingTask);
+                ACOUSTICS_TRACE_SCOPE("Acoustics::StreamingTask");
+                m_Task->Execute();
+            }
+            SET_FLOAT_STAT(STAT_Acoustics_StreamingQueueTime, queuedMs);
+            if (AcousticsTrace::IsEnabled())
+            {
+                AcousticsTrace::OutputStreamingTask(
+                    m_TaskId,
+                    m_QueueCycles,
+                    startCycles,
+                    FPlatformTime::Cycles64(),
+                    FTritonUnrealIOHook::GetBytesReadOnThisThread() - startBytesRead);
+            }
+            Finish();
         }
 
         /**
@@ -327,40 +1109,59 @@ namespace TritonRuntime
         virtual void Abandon() override
         {
             // most implementations of IQueuedWork do this to signal completion.
-            FPlatformAtomics::InterlockedDecrement(m_DoneCounter);
+            Finish();
         }
 
-        /** The function to execute on the Task Graph. */
-        TFunction<void()> m_Function;
+    private:
+        void Finish()
+        {
+            // The hook may be destroyed as soon as the counter drops, so nothing of it can be touched after this
+            auto doneCounter = m_DoneCounter;
+            delete this;
+            doneCounter->Decrement();
+        }
 
-        volatile int32* m_DoneCounter;
+        TUniquePtr<TaskFunc> m_Task;
+        uint32 m_TaskId;
+        uint64 m_QueueCycles;
+        FAcousticsTaskCounter* m_DoneCounter;
     };
 
-    FTritonAsyncTaskHook::FTritonAsyncTaskHook() : m_NumRunningTasks(0)
+    // How long Wait goes before reporting the streaming tasks that are still outstanding
+    constexpr double c_StreamingWaitWarningSeconds = 5.0;
+
+    FTritonAsyncTaskHook::FTritonAsyncTaskHook(FQueuedThreadPool* threadPool)
+        : m_ThreadPool(threadPool != nullptr ? threadPool : GThreadPool), m_NumLaunchedTasks(0)
     {
     }
 
     FTritonAsyncTaskHook::~FTritonAsyncTaskHook()
     {
+        // Tasks still in flight count down on this hook
+        Wait();
     }
 
     void FTritonAsyncTaskHook::Launch(const TaskFunc* task)
     {
-        // Make a local deep copy of Task, as the object has no existence guarantee beyond this call
-        m_TaskFunc.Reset(task->Clone());
-        TFunction<void()> Function([this]() { m_TaskFunc->Execute(); });
-
-        FPlatformAtomics::InterlockedIncrement(&m_NumRunningTasks);
-
-        GThreadPool->AddQueuedWork(new FTritonLoadAsyncTask(MoveTemp(Function), &m_NumRunningTasks));
+        // Make a local deep copy of Task, as the object has no existence guarantee beyond this call. Each launch gets
+        // its own copy, since a new launch can come in while the previous task is still winding down.
+        m_RunningTasks.Increment();
+        m_ThreadPool->AddQueuedWork(new FTritonLoadAsyncTask(task->Clone(), ++m_NumLaunchedTasks, &m_RunningTasks));
     }
 
     void FTritonAsyncTaskHook::Wait()
     {
-        // Busy loop. Called only during map unload when doing non-blocking streaming.
-        while (m_NumRunningTasks > 0)
+        // Called during map unload and when the instance is cleared. Sleeps until the last task signals.
+        auto waitedSeconds = 0.0;
+        while (!m_RunningTasks.Wait(c_StreamingWaitWarningSeconds))
         {
-            FPlatformProcess::Sleep(0);
+            waitedSeconds += c_StreamingWaitWarningSeconds;
+            UE_LOG(
+                LogAcousticsRuntime,
+                Warning,
+                TEXT("Still waiting for %d Triton streaming tasks after %.0f seconds"),
+                m_RunningTasks.GetCount(),
+                waitedSeconds);
         }
     }
 
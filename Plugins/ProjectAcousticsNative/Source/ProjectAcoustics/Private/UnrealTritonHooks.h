@@ -5,8 +5,12 @@
 
 #include "TritonHooks.h"
 #include "Async/AsyncFileHandle.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/QueuedThreadPool.h"
 #include "Stats/Stats.h"
 #include "IAcoustics.h"
+#include "AcousticsTaskCounter.h"
+#include "AcousticsShardedCounter.h"
 
 namespace TritonRuntime
 {
@@ -21,43 +25,181 @@ namespace TritonRuntime
     };
 
     // Implements the interface for memory alloc/dealloc operations. All operations *must* be thread-safe.
-    // Routes all of Triton's internal new/deletes to UE's FMemory::* versions.
+    // Small allocations come from size-class pools of fixed size blocks carved out of slabs, which are kept for reuse
+    // rather than given back. Larger ones go to UE's FMemory::* versions. Every block starts with a header holding
+    // its size and allocation scope, so no allocator has to be asked for the size when it is freed.
     class FTritonMemHook : public ITritonMemHook
     {
-        volatile int64 m_TotalMemoryUsed;
-        virtual void* Malloc(size_t inSize);
-        virtual void* Realloc(void* inPtr, size_t size);
-        virtual void Free(void* inPtr);
-
     public:
-        FTritonMemHook();
+        // Size classes are powers of two and the midpoints between them, from 16 bytes up to this
+        static constexpr int32 c_MaxPooledSize = 16 * 1024;
+        static constexpr int32 c_NumSizeClasses = 21;
+        // Allocation scopes past this many are counted as unscoped
+        static constexpr int32 c_MaxScopes = 16;
+
+        // Precedes every block handed out
+        struct FBlockHeader;
+
+        // Memory of one allocation scope
+        struct FScopeMemory
+        {
+            FString Name;
+            int64 BytesUsed;
+        };
+
+        explicit FTritonMemHook(const bool usePools);
+        virtual ~FTritonMemHook();
+
+        virtual void* Malloc(size_t inSize) override;
+        virtual void* Realloc(void* inPtr, size_t size) override;
+        virtual void Free(void* inPtr) override;
+        // Scopes nest per thread. Allocations made inside a scope are counted against it until they are freed.
+        virtual void StartAllocationScope(const wchar_t* scopeName) override;
+        virtual void StopAllocationScope(const wchar_t* scopeName) override;
+
+        // Caps the memory reserved from the engine, pooled slabs plus large blocks. Allocations that would go over it
+        // fail. 0 is unlimited. Slabs are never trimmed, so memory that went back to a pool still counts against it.
+        void SetBudget(const int64 budgetBytes);
+
+        // Bytes in blocks handed out to Triton
         int64 GetTotalMemoryUsed() const;
+        // Bytes reserved from the engine. The difference to the memory used is sitting in free pooled blocks.
+        int64 GetTotalMemoryReserved() const;
+        // The most memory that has been reserved at any one time
+        int64 GetPeakMemoryReserved() const;
+        // Bytes Triton asked for. The difference to the memory used is lost to rounding up to a size class.
+        int64 GetTotalMemoryRequested() const;
+        int64 GetNumFailedAllocations() const;
+        void GetScopeMemory(TArray<FScopeMemory>& outScopes) const;
+
+    private:
+        // Fixed size blocks of one size class. Blocks are taken and freed without locking, the lock is only taken to
+        // add a slab when the pool runs dry. Slabs stay with the pool until the hook is destroyed: a lock-free pop may
+        // still be reading a block that was just taken, so no slab can be given back while Triton is running.
+        struct FSizeClassPool
+        {
+            // Top of a stack of free blocks, linked through their payloads so that freeing never allocates. Packed
+            // with a tag that changes on every push and pop, so a pop that raced with others fails rather than
+            // putting a block that was taken in the meantime back on top (ABA).
+            alignas(PLATFORM_CACHE_LINE_SIZE) volatile int64 FreeHead = 0;
+            FCriticalSection GrowLock;
+            TArray<void*> Slabs;
+        };
+
+        void* AllocateBlock(const int32 sizeClass, const uint64 requestedSize);
+        void FreeBlock(FBlockHeader* header);
+        static FBlockHeader* PopFreeBlock(FSizeClassPool& pool);
+        static void PushFreeBlocks(FSizeClassPool& pool, FBlockHeader* first, FBlockHeader* last);
+        bool ReserveMemory(const int64 bytes);
+        void ReleaseMemory(const int64 bytes);
+        void CountBlock(const FBlockHeader* header, const int64 sign);
+        uint16 FindOrAddScope(const wchar_t* scopeName);
+
+        const bool m_UsePools;
+        FSizeClassPool m_Pools[c_NumSizeClasses];
+        // Change on every allocation, so they are sharded to keep threads from contending on them
+        FAcousticsShardedCounter m_TotalMemoryUsed;
+        FAcousticsShardedCounter m_TotalMemoryRequested;
+        // Only change when the pools grow or for large blocks, and have to be exact to enforce the budget
+        volatile int64 m_TotalMemoryReserved;
+        volatile int64 m_PeakMemoryReserved;
+        volatile int64 m_NumFailedAllocations;
+        volatile int64 m_BudgetBytes;
+
+        // Scope 0 is for allocations made outside any scope. Scopes are only ever added, under m_ScopeLock, and
+        // m_NumScopes is bumped once a scope is complete.
+        FAcousticsShardedCounter m_ScopeBytesUsed[c_MaxScopes];
+        // Name pointer each scope was added with, to find it again without comparing every name
+        const wchar_t* m_ScopeKeys[c_MaxScopes];
+        FString m_ScopeNames[c_MaxScopes];
+        volatile int32 m_NumScopes;
+        FCriticalSection m_ScopeLock;
+    };
+
+    // Random access reads from an ACE file
+    class IAcousticsFileReader
+    {
+    public:
+        virtual ~IAcousticsFileReader()
+        {
+        }
+        virtual bool IsOK() const = 0;
+        virtual int64 GetFileSize() const = 0;
+        virtual uint64 Read(uint64 readOffset, void* destBuffer, uint64 bytesToRead) = 0;
+        virtual int64 GetBytesRead() const = 0;
     };
 
-    // Handles file I/O for UFS.
-    class FCachedSyncDiskReader
+    // Handles file I/O for UFS. Keeps the most recently used blocks of the file in an LRU cache, and reads ahead
+    // asynchronously when the file is being read front to back.
+    class FCachedSyncDiskReader : public IAcousticsFileReader
     {
     private:
+        // One block-aligned range of the file
+        struct FCacheBlock
+        {
+            // Empty until the block is first filled
+            TArray<uint8> Data;
+            // Index of the block in the file, INDEX_NONE if the block holds nothing
+            int64 BlockIndex = INDEX_NONE;
+            uint64 Size = 0;
+            uint64 LastUsed = 0;
+            // Read-ahead that is still filling Data
+            TUniquePtr<IAsyncReadRequest> PendingRequest;
+        };
+
         FString m_FileName;
         TUniquePtr<IAsyncReadFileHandle> m_FileHandle;
 
-        TArray<unsigned char> m_CacheData;
-        size_t m_CacheSize;
-        size_t m_CacheFileOffset;
-        bool m_IsCacheInvalid;
+        TArray<FCacheBlock> m_CacheBlocks;
+        uint64 m_BlockSize;
+        int32 m_NumReadAheadBlocks;
+        int32 m_MaxReadsInFlight;
+        uint64 m_UseCounter;
+        // Last block that was read and how many blocks in a row were read in order before it
+        int64 m_LastBlockIndex;
+        int32 m_NumSequentialBlocks;
 
         int64 m_FileSize;
         uint64 _DiskRead(uint64 fileOffset, void* destBuffer, uint64 bytesToRead);
+        FCacheBlock* FindOrReadBlock(const int64 blockIndex);
+        FCacheBlock* FindBlock(const int64 blockIndex);
+        FCacheBlock* FindBlockToEvict(const bool allowPending);
+        bool CompletePendingRead(FCacheBlock& block);
+        void ReadAhead(const int64 blockIndex);
+        uint64 GetBlockSize(const int64 blockIndex) const;
+        uint8* GetBlockData(FCacheBlock& block);
 
         volatile int64 m_BytesRead;
 
     public:
-        FCachedSyncDiskReader(const FString& fileName, uint64 cacheSize);
+        FCachedSyncDiskReader(
+            const FString& fileName, uint64 blockSize, int32 numCacheBlocks, int32 numReadAheadBlocks,
+            int32 maxReadsInFlight);
         virtual ~FCachedSyncDiskReader();
-        bool IsOK() const;
-        int64 GetFileSize() const;
-        uint64 Read(uint64 readOffset, void* destBuffer, uint64 bytesToRead);
-        int64 GetBytesRead() const;
+        virtual bool IsOK() const override;
+        virtual int64 GetFileSize() const override;
+        virtual uint64 Read(uint64 readOffset, void* destBuffer, uint64 bytesToRead) override;
+        virtual int64 GetBytesRead() const override;
+    };
+
+    // Maps the whole ACE file into memory, so that every read is a single copy out of the mapping, with no read
+    // requests or intermediate buffers. Only works for loose files on platforms that support memory mapping.
+    class FMappedFileReader : public IAcousticsFileReader
+    {
+    private:
+        TUniquePtr<IMappedFileHandle> m_MappedHandle;
+        TUniquePtr<IMappedFileRegion> m_MappedRegion;
+        int64 m_FileSize;
+
+        volatile int64 m_BytesRead;
+
+    public:
+        FMappedFileReader(const FString& fileName);
+        virtual ~FMappedFileReader();
+        virtual bool IsOK() const override;
+        virtual int64 GetFileSize() const override;
+        virtual uint64 Read(uint64 readOffset, void* destBuffer, uint64 bytesToRead) override;
+        virtual int64 GetBytesRead() const override;
     };
 
     // Implements Triton's Interface for blocking I/O from a single file/asset. Operations need not be thread-safe.
@@ -66,41 +208,75 @@ namespace TritonRuntime
     {
     private:
         uint64 m_FileOffset;
-        static const size_t m_ReadCacheSize;
-        TUniquePtr<FCachedSyncDiskReader> m_DiskReader;
+        TUniquePtr<IAcousticsFileReader> m_DiskReader;
+        bool m_UseMemoryMapping;
+        uint64 m_ReadBlockSize;
+        int32 m_NumReadCacheBlocks;
+        int32 m_NumReadAheadBlocks;
+        int32 m_MaxReadsInFlight;
 
     public:
-        FTritonUnrealIOHook();
+        // When useMemoryMapping is set, the file is memory mapped if the platform allows it. Otherwise reads go
+        // through a cache of numReadCacheBlocks blocks of readBlockSize bytes, reading up to numReadAheadBlocks
+        // blocks ahead when the file is read in order. Reads larger than a block are split into up to
+        // maxReadsInFlight concurrent requests.
+        FTritonUnrealIOHook(
+            const bool useMemoryMapping = false, const uint64 readBlockSize = 1024 * 1024,
+            const int32 numReadCacheBlocks = 16, const int32 numReadAheadBlocks = 2, const int32 maxReadsInFlight = 4);
         virtual ~FTritonUnrealIOHook();
         virtual bool OpenForRead(const char* name) override;
         virtual size_t Read(void* destBuffer, size_t elementSize, size_t numElementsToRead) override;
         virtual bool Seek(uint32_t offset) override;
         virtual bool SeekFromCurrent(uint32_t offset) override;
         virtual bool Close() override;
+        bool IsOpen() const;
         int64 GetFileSize() const;
         int64 GetBytesRead() const;
+        // Bytes read from all ACE files since startup, including ones that have since been closed
+        static int64 GetBytesReadByAllFiles();
+        // Bytes read from all ACE files by the calling thread since it started
+        static int64 GetBytesReadOnThisThread();
     };
 
     // Implements Triton's Interface for launching an asynchronous task.
-    // Queues tasks onto UE's GThreadPool
+    // Queues tasks onto the given thread pool, or UE's GThreadPool if there is none. The pool must outlive the hook.
     class FTritonAsyncTaskHook : public ITritonAsyncTaskHook
     {
     private:
-        TUniquePtr<TaskFunc> m_TaskFunc;
-        FGraphEventRef m_TaskRef;
+        FQueuedThreadPool* m_ThreadPool;
         FCriticalSection m_Lock;
-        volatile int32 m_NumRunningTasks;
+        FAcousticsTaskCounter m_RunningTasks;
+        // Numbers the tasks in profiler captures
+        uint32 m_NumLaunchedTasks;
 
     public:
-        FTritonAsyncTaskHook();
+        FTritonAsyncTaskHook(FQueuedThreadPool* threadPool = nullptr);
         virtual ~FTritonAsyncTaskHook();
         virtual void Launch(const TaskFunc* task) override;
         virtual void Wait() override;
         virtual void Lock() override;
         virtual void Unlock() override;
+
+        // Whether every task launched so far has finished
+        bool IsIdle() const
+        {
+            return m_RunningTasks.GetCount() == 0;
+        }
     };
 } // namespace TritonRuntime
 
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Acoustics Memory Usage"), STAT_Acoustics_Memory, STATGROUP_Acoustics, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Acoustics Memory Reserved"), STAT_Acoustics_MemoryReserved, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Acoustics Allocations Over Budget"), STAT_Acoustics_FailedAllocations, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Acoustics Total Bytes Read"), STAT_Acoustics_FileReads, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Acoustics Read Cache Hits"), STAT_Acoustics_ReadCacheHits, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Acoustics Read Cache Misses"), STAT_Acoustics_ReadCacheMisses, STATGROUP_Acoustics, );
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
-    TEXT("Acoustics Total Bytes Read"), STAT_Acoustics_FileReads, STATGROUP_Acoustics, );
\ No newline at end of file
+    TEXT("Acoustics Read-Ahead Bytes"), STAT_Acoustics_ReadAheadBytes, STATGROUP_Acoustics, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Triton Streaming Task"), STAT_Acoustics_StreamingTask, STATGROUP_Acoustics, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(
+    TEXT("Triton Streaming Queue Time (ms)"), STAT_Acoustics_StreamingQueueTime, STATGROUP_Acoustics, );
\ No newline at end of file
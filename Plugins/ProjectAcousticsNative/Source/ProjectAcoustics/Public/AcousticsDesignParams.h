@@ -157,4 +157,6 @@ struct AcousticsObjectParams
     TritonDynamicOpeningInfo DynamicOpeningInfo;
     //! Additional settings for the interpolator for this source
     TritonRuntime::InterpolationConfig InterpolationConfig;
+    //! Added to this voice's importance when queries are ranked against a limited per-frame budget
+    float QueryPriority;
 };
\ No newline at end of file
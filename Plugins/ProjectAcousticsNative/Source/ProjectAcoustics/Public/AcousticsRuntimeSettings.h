@@ -0,0 +1,27 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+#include "UObject/Object.h"
+#include "AcousticsRuntimeSettings.generated.h"
+
+/**
+ * Project-wide settings for the Project Acoustics runtime. These control how the acoustics engine schedules its
+ * work and are read when an ACE file is loaded.
+ */
+UCLASS(config = Engine, defaultconfig)
+class PROJECTACOUSTICS_API UAcousticsRuntimeSettings : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     *    Number of worker threads used to run background acoustic queries. Sources are sharded across the workers
+     *    so that queries for a single source always run in order. 0 picks a count based on the number of cores.
+     *    Can be overridden at runtime with PA.QueryWorkerThreads, takes effect on the next ACE file load.
+     */
+    UPROPERTY(
+        GlobalConfig, EditAnywhere, Category = "Queries",
+        meta = (ClampMin = 0, ClampMax = 16, UIMin = 0, UIMax = 16, DisplayName = "Query Worker Threads"))
+    int32 NumQueryWorkerThreads = 1;
+};
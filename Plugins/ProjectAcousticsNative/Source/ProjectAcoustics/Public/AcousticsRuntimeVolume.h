@@ -28,4 +28,17 @@ public:
      */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustics")
     FAcousticsDesignParams OverrideDesignParams;
+
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void Tick(float DeltaSeconds) override;
+
+private:
+    // Hands the volume's current shape to the acoustics system, which looks volumes up without touching physics
+    void RegisterWithAcoustics();
+
+    class IAcoustics* m_Acoustics;
+    // Transform and design params the volume was last registered with, so changes can be picked up
+    FTransform m_RegisteredTransform;
+    FAcousticsDesignParams m_RegisteredDesignParams;
 };
\ No newline at end of file
@@ -36,6 +36,14 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
     UAcousticsData* AcousticsData;
 
+    /** Add this space's ACE file to the ones already loaded instead of replacing them, and remove it again when the
+     * actor leaves play. Use this for AcousticsSpaces in streamed sublevels that have their own bake, alongside the
+     * AcousticsSpace of the persistent level. Only AcousticsData and CacheScale are used from an additive space,
+     * everything else comes from the persistent level's AcousticsSpace.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
+    bool AdditiveLoad;
+
     /** Tile size for streaming acoustic data. Probes within this tile centered at player are kept loaded in RAM.
      * Small tile size will reduce RAM but at cost of frequent loading. Huge sizes containing all probes will load
      * full data into RAM. Unless tile is too small to keep up with player motion, acoustics is unaffected by tile size.
@@ -49,6 +57,16 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustics")
     bool AutoStream;
 
+    /** How many seconds ahead the listener's motion is predicted when automatically streaming. The loaded tile is
+     * stretched along the predicted path, by at most one tile size, and reloaded before the listener's predicted
+     * position leaves it, so that fast moving listeners don't outrun the loaded probes. Larger values keep up with
+     * faster motion at the cost of more RAM. 0 disables prediction.
+     */
+    UPROPERTY(
+        EditAnywhere, BlueprintReadWrite, Category = "Acoustics",
+        meta = (EditCondition = "AutoStream", UIMin = 0, ClampMin = 0, UIMax = 5, Units = "s"))
+    float StreamingPredictionHorizon;
+
     /** Controls the size of the cache used for Acoustic queries. 0 = no cache, 1 = full cache
      * Smaller caches use less RAM, but have longer lookup times
      * Must be set before the ACE file is loaded
@@ -161,6 +179,7 @@ public:
 
     // AActor methods
     void BeginPlay() override;
+    void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     void Tick(float deltaSeconds) override;
     void BeginDestroy() override;
     void PostActorCreated() override;
@@ -174,9 +193,18 @@ private:
     // Helper to convert from UAcousticsData to a real filepath that Triton can load
     bool LoadAceFile(FString filePath);
     FVector GetListenerPosition();
+    void UpdateListenerPositions();
     class IAcoustics* m_Acoustics;
 
     FTransform m_LastSpaceTransform;
+    // The ACE file this space added, if it is additive
+    FString m_AddedAceFilePath;
+
+    // Location of every local listener, and their smoothed velocity used to predict where to stream
+    void UpdateListenerVelocities(const float deltaSeconds);
+    TArray<FVector> m_ListenerPositions;
+    TArray<FVector> m_LastListenerPositions;
+    TArray<FVector> m_ListenerVelocities;
 
 #if !UE_BUILD_SHIPPING
 private:
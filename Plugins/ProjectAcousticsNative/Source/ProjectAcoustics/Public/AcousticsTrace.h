@@ -0,0 +1,15 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+// Unreal Insights channel for the acoustics pipeline: queries, tile streaming and HRTF processing. Off by default,
+// turn it on with -trace=default,Acoustics on the command line or Trace.Enable Acoustics in the console.
+UE_TRACE_CHANNEL_EXTERN(AcousticsChannel, PROJECTACOUSTICS_API);
+
+// Times the enclosing scope on the acoustics channel. Name must be a string literal.
+#define ACOUSTICS_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, AcousticsChannel)
@@ -11,6 +11,31 @@
 DECLARE_LOG_CATEGORY_EXTERN(LogAcousticsRuntime, Log, All);
 DECLARE_STATS_GROUP(TEXT("Project Acoustics"), STATGROUP_Acoustics, STATCAT_Advanced);
 
+/**
+ * Counters for production telemetry, available in all builds. Totals count from when the module started up.
+ */
+struct FAcousticsTelemetry
+{
+    // Bytes Triton is using now
+    int64 MemoryUsed = 0;
+    // Bytes reserved from the engine for Triton, including pooled blocks that are free, and the most ever reserved.
+    // The high-water mark is exact, it is tracked on every allocation that reserves memory.
+    int64 MemoryReserved = 0;
+    int64 MemoryHighWaterMark = 0;
+    int64 FailedAllocations = 0;
+    // Bytes read from ACE files
+    int64 BytesRead = 0;
+    // Regions of probes requested from Triton, for streamed tiles and their steps
+    int64 TileLoads = 0;
+    int64 FailedTileLoads = 0;
+    int64 ProbesRequested = 0;
+    // Eviction steps taken to stay under PA.MemoryBudgetMB
+    int64 Evictions = 0;
+    // Acoustic queries made, and those that found no usable probe data
+    int64 Queries = 0;
+    int64 FailedQueries = 0;
+};
+
 /**
  * The public interface to this module.  In most cases, this interface is only public to sibling modules
  * within this plugin.
@@ -43,21 +68,40 @@ public:
     // Must not be simultaneously accessed by two threads
 
     /**
-     * Loads the ACE file that contains acoustic parameters for the scene
+     * Loads the ACE file that contains acoustic parameters for the scene, replacing the one loaded by the previous
+     * call. Files added with AddAceFile stay loaded.
      * File must be located in the project's Content/Acoustics directory
+     * While other files are loaded, the new set of files is loaded in the background and swapped in by a later
+     * PostTick, with queries answered by the previous files until then (PA.HotSwapAceFiles). In that case the return
+     * value only covers opening the file.
      *
      * @return True if the ACE file is successfully loaded
      */
     virtual bool LoadAceFile(const FString& filePath, const float cacheScale) = 0;
 
     /**
-     * Unload the currently loaded ACE file.
+     * Unload the ACE file loaded with LoadAceFile. Files added with AddAceFile stay loaded.
      *
      * @param clearOldQueries - Clear any old queries that haven't been cleaned up yet. You may not want to do this
      * if you at the start or in the middle of a scene.
      */
     virtual void UnloadAceFile(bool clearOldQueries) = 0;
 
+    /**
+     * Adds an ACE file to the ones already loaded, such as the bake of a streamed sublevel. All loaded files are
+     * combined into one acoustic scene, and the probes around the listeners are streamed in again. Like LoadAceFile,
+     * this is a hot-swap while other files are loaded.
+     * File must be located in the project's Content/Acoustics directory
+     *
+     * @return True if the ACE file is successfully loaded
+     */
+    virtual bool AddAceFile(const FString& filePath, const float cacheScale) = 0;
+
+    /**
+     * Removes an ACE file added with AddAceFile, keeping the others loaded
+     */
+    virtual void RemoveAceFile(const FString& filePath) = 0;
+
     /**
      * Register a new dynamic opening with acoustic system
      */
@@ -78,6 +122,40 @@ public:
     virtual bool
     UpdateDynamicOpening(class UAcousticsDynamicOpening* opening, float dryAttenuationDb, float wetAttenuationDb) = 0;
 
+    /**
+     * Register a runtime volume with the acoustic system, or update its shape if it moved
+     *
+     * @param volume The volume, used as its ID
+     * @param worldId Unique ID of the world the volume is in. Only sounds in the same world are affected.
+     * @param bounds World space bounds of the volume
+     * @param hulls Convex hulls making up the volume, each as a list of outward facing world space planes. If
+     * empty, the volume is treated as its bounds.
+     * @param overrideParams The design overrides for sounds inside the volume
+     */
+    virtual void AddRuntimeVolume(
+        class AAcousticsRuntimeVolume* volume, const uint32 worldId, const FBox& bounds,
+        const TArray<TArray<FPlane>>& hulls, const FAcousticsDesignParams& overrideParams) = 0;
+
+    /**
+     * Unregister a runtime volume with the acoustic system
+     */
+    virtual bool RemoveRuntimeVolume(class AAcousticsRuntimeVolume* volume) = 0;
+
+    /**
+     * Update the design overrides of a runtime volume
+     *
+     * @return True on success.
+     */
+    virtual bool
+    UpdateRuntimeVolume(class AAcousticsRuntimeVolume* volume, const FAcousticsDesignParams& overrideParams) = 0;
+
+    /**
+     * Combine the design overrides of all runtime volumes containing location into designParams. Safe to call from
+     * any thread.
+     */
+    virtual void ApplyRuntimeVolumeOverrides(
+        const uint32 worldId, const FVector& location, FAcousticsDesignParams& designParams) const = 0;
+
     /**
      * Sets global design settings that are applied to all acoustic queries
      */
@@ -106,6 +184,14 @@ public:
         const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
         AcousticsObjectParams& parameters) = 0;
 
+    /**
+     * Preallocates the per-source query state for source IDs in [0, maxSources). Source IDs passed to the functions
+     * below must be smaller than the largest value passed here. Call before any source is registered.
+     *
+     * @param maxSources The maximum number of sources the audio mixer can play at once
+     */
+    virtual void SetMaxSources(const int32 maxSources) = 0;
+
     /*
      * All sources need to register with their sourceId before they can start processing. This adds the source
      * to the internal map caching results.
@@ -122,14 +208,42 @@ public:
      */
     virtual void UnregisterSourceObject(const uint64_t sourceObjectId) = 0;
 
+    /**
+     * Starts a background query for a sound that is about to start playing, so that its first update doesn't have
+     * to query on the audio thread. Call from the game thread when the sound is played. The result is picked up
+     * by the first update of any source registered close to sourceLocation.
+     *
+     * @param sourceLocation Where the sound will play
+     * @param listenerLocation The current listener location
+     * @param objectParams Only the interpolation config and dynamic opening settings are used
+     */
+    virtual void WarmUpQuery(
+        const FVector& sourceLocation, const FVector& listenerLocation, const AcousticsObjectParams& objectParams) = 0;
+
+    /**
+     * Sets the listeners that outdoorness is tracked for, such as one per split-screen player. Each listener's
+     * outdoorness is cached separately, and UpdateObjectParameters reports the outdoorness of the listener closest to
+     * the listener location it is given. Call from the game thread once per frame. Up to 8 listeners are tracked.
+     */
+    virtual void SetListenerLocations(TArrayView<const FVector> listenerLocations) = 0;
+
     virtual bool UpdateOutdoorness(const FVector& listenerLocation) = 0;
+    // Outdoorness at the first listener
     virtual float GetOutdoorness() const = 0;
+    // Outdoorness at the tracked listener closest to listenerLocation
+    virtual float GetOutdoornessForListener(const FVector& listenerLocation) const = 0;
     virtual bool CalculateReverbSendWeights(
         const float targetReverbTime, const uint32_t numReverbs, const float* reverbTimes,
         float* reverbSendWeights) const = 0;
 
     virtual bool PostTick() = 0;
 
+    /**
+     * Called once all sources have been updated for the current audio tick. When query batching is enabled
+     * (PA.BatchQueries), this hands the queries collected during the tick to the query workers.
+     */
+    virtual void PostAudioTick() = 0;
+
     /**
      * Update Triton's internal listener distance data based on given listener location
      *
@@ -145,12 +259,47 @@ public:
     virtual bool QueryDistance(const FVector& lookDirection, float& outDistance) = 0;
 
     /**
-     * Used for ACE streaming. For the given player position, update which parts of the ACE file are loaded in memory
+     * Used for ACE streaming. For the given player position, update which parts of the ACE file are loaded in memory.
+     * Unless blockOnCompletion is set, the tile is streamed in over several frames, nearest probes first, within the
+     * PA.Streaming* budgets.
      */
     virtual void UpdateLoadedRegion(
         const FVector& playerPosition, const FVector& tileSize, const bool forceUpdate,
         const bool unloadProbesOutsideTile, const bool blockOnCompletion) = 0;
 
+    /**
+     * Used for predictive ACE streaming. Like UpdateLoadedRegion, but the loaded region is stretched along the path
+     * the player is predicted to take, and is reloaded before the predicted position leaves it. This keeps probes
+     * ahead of a fast moving player loaded before they are needed.
+     *
+     * @param playerVelocity Velocity of the player in world units per second
+     * @param predictionTime How many seconds ahead to predict the player's position. 0 behaves like
+     * UpdateLoadedRegion.
+     */
+    virtual void UpdateLoadedRegionPredictive(
+        const FVector& playerPosition, const FVector& playerVelocity, const float predictionTime,
+        const FVector& tileSize, const bool forceUpdate, const bool unloadProbesOutsideTile,
+        const bool blockOnCompletion) = 0;
+
+    /**
+     * Used for ACE streaming with several listeners, such as split-screen. Keeps a tile loaded around each listener,
+     * stretched along its predicted path like UpdateLoadedRegionPredictive, and only reloads the tiles of the
+     * listeners that moved out of theirs. When unloadProbesOutsideTile is set, probes are unloaded once they are
+     * outside every listener's tile. Up to 8 listeners are tracked.
+     *
+     * @param listenerPositions The location of each listener
+     * @param listenerVelocities The velocity of each listener in world units per second, in the same order
+     */
+    virtual void UpdateLoadedRegions(
+        TArrayView<const FVector> listenerPositions, TArrayView<const FVector> listenerVelocities,
+        const float predictionTime, const FVector& tileSize, const bool forceUpdate,
+        const bool unloadProbesOutsideTile, const bool blockOnCompletion) = 0;
+
+    /**
+     * Takes a snapshot of the telemetry counters. Cheap enough to call every frame, and safe to call from any thread.
+     */
+    virtual FAcousticsTelemetry GetTelemetry() const = 0;
+
     // Convert between a world position (UE coordinates) to Triton
     // Takes into account any active transformations of the AcousticsSpace actor
     virtual FVector TritonPositionToWorld(const FVector& vec) const = 0;
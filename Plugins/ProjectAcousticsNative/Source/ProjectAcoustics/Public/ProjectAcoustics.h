@@ -6,6 +6,10 @@
 #include "Modules/ModuleManager.h"
 #include "IAcoustics.h"
 #include "UnrealTritonHooks.h"
+#include "AcousticsQueryCache.h"
+#include "AcousticsTaskCounter.h"
+#include "AcousticsShardedCounter.h"
+#include "AcousticsRuntimeVolumeIndex.h"
 #include "AcousticsDesignParams.h"
 #include "TritonDebugInterface.h"
 #include "Async/Async.h"
@@ -21,7 +25,7 @@ class FProjectAcousticsDebugRender;
 class FAcousticsQueuedWork : public IQueuedWork
 {
 public:
-    FAcousticsQueuedWork(TFunction<void()>&& inFunction, volatile int32* inDoneCounter)
+    FAcousticsQueuedWork(TFunction<void()>&& inFunction, FAcousticsTaskCounter* inDoneCounter)
         : m_Function(inFunction), m_DoneCounter(inDoneCounter)
     {
     }
@@ -41,14 +45,25 @@ public:
     void SignalStart()
     {
         FPlatformAtomics::AtomicStore(&m_IsQueuedOrRunning, 1);
-        FPlatformAtomics::InterlockedIncrement(m_DoneCounter);
+        m_DoneCounter->Increment();
+    }
+
+    // Like SignalStart, for items that several threads may try to queue. Returns false if it was already queued.
+    bool TrySignalStart()
+    {
+        if (FPlatformAtomics::InterlockedCompareExchange(&m_IsQueuedOrRunning, 1, 0) != 0)
+        {
+            return false;
+        }
+        m_DoneCounter->Increment();
+        return true;
     }
 
     // Signal to the counters that this item has finished, retracted, or abandoned
     void SignalStop()
     {
         FPlatformAtomics::AtomicStore(&m_IsQueuedOrRunning, 0);
-        FPlatformAtomics::InterlockedDecrement(m_DoneCounter);
+        m_DoneCounter->Decrement();
     }
 
     /** The function to execute on the Task Graph. */
@@ -59,7 +74,7 @@ public:
     volatile int32 m_IsQueuedOrRunning = 0;
 
     // For updating a caller's running task counter
-    volatile int32* m_DoneCounter;
+    FAcousticsTaskCounter* m_DoneCounter;
 };
 
 // All the results from a Triton acoustics query
@@ -72,17 +87,201 @@ struct AcousticQueryResults
     bool QueryResult;
 };
 
-// Holds the data for a queued acoustics query
-struct AsyncAcousticQueryResults
+// Per-source query state. One slot is preallocated for every source ID the audio mixer can hand out (see
+// SetMaxSources), so the audio thread and the query workers exchange results through State without any locks.
+struct FAcousticQuerySlot
 {
-    // Results from an acoustics query will be placed here when ready
-    TFuture<AcousticQueryResults> QueryResults;
-    // This is the queued work item. Saving this so we can retract it from the pool if needed
+    // Packed as (generation << 2) | (registered << 1) | ready. The generation is bumped whenever the source is
+    // registered or unregistered, so a query started for an earlier owner of the slot can't publish its results.
+    volatile int64 State = 0;
+    // Written by whoever sets the ready bit. Only read by the audio thread after it sees the ready bit.
+    AcousticQueryResults Results;
+    // Inputs of the background query. Written by the audio thread before the query is queued.
+    uint64_t SourceObjectId = 0;
+    FVector SourceLocation = FVector::ZeroVector;
+    FVector ListenerLocation = FVector::ZeroVector;
+    AcousticsObjectParams ObjectParams = {};
+    int64 QueryGeneration = 0;
+    // When the query was handed to its worker, in cycles, for the trace of its time spent queued
+    uint64 QueuedCycles = 0;
+    // Work item reused for every background query of this source
     TUniquePtr<FAcousticsQueuedWork> QueuedWork;
-    // Whether or not this source has processed any frames so far
+    // Index of this source's job in the pending batch, if it has one. Audio thread only.
+    int32 PendingJobIndex = INDEX_NONE;
+    // Inputs of the last query that was started, used to skip queries when nothing moved. Audio thread only.
+    FVector LastQuerySourceLocation = FVector::ZeroVector;
+    FVector LastQueryListenerLocation = FVector::ZeroVector;
+    int32 UpdatesSinceQuery = 0;
+    // Updates since the source last got results from a query it hadn't seen yet. Audio thread only.
+    int32 UpdatesSinceFreshResult = 0;
+    // Whether or not this source has processed any frames so far. Audio thread only.
     bool HasProcessed = false;
-    // Whether or not a retraction has been issued on this async query
-    bool RetractionRequested = false;
+    // Whether the first query ran out of sync budget and was sent to the query workers instead. Audio thread only.
+    bool IsFirstQueryPending = false;
+    // Whether Results still hold the last results handed out, for reuse while no new query is running. Audio
+    // thread only.
+    bool HasLastResults = false;
+    // Whether this source is waiting in the deferred query list. Audio thread only.
+    bool IsDeferred = false;
+    // Parameter ramp towards the latest result (PA.TemporalSmoothing). Starts from the parameters handed out when the
+    // latest result arrived, so a new result never causes a step. Audio thread only.
+    TritonAcousticParameters SmoothingStart = {};
+    TritonAcousticParameters SmoothingTarget = {};
+    double SmoothingStartTime = 0.0;
+    double SmoothingDuration = 0.0;
+    bool HasSmoothingTarget = false;
+};
+
+// A query started for a sound that is about to play (see WarmUpQuery), or for a first query that can't run on the
+// audio thread. Its result goes to the query cache, where the source's next update finds it.
+struct FAcousticWarmUpQuery
+{
+    // Written by whichever thread claimed QueuedWork
+    FVector SourceLocation = FVector::ZeroVector;
+    FVector ListenerLocation = FVector::ZeroVector;
+    TritonRuntime::InterpolationConfig InterpolationConfig;
+    TUniquePtr<FAcousticsQueuedWork> QueuedWork;
+};
+
+// A region of probes kept loaded around a listener for ACE streaming, in world space
+struct FAcousticLoadedRegion
+{
+    FVector Center = FVector::ZeroVector;
+    FVector Size = FVector::ZeroVector;
+};
+
+// One step of loading a listener's tile when streaming is paced (see ProcessStreamingQueue). A tile is loaded as a
+// series of growing boxes starting at the listener, so the nearest probes arrive first.
+struct FAcousticStreamingChunk
+{
+    int32 ListenerIndex = 0;
+    FAcousticLoadedRegion Region;
+    // The whole tile, which also unloads what the listener left behind
+    bool IsFinal = false;
+};
+
+// What paced streaming has loaded for one listener
+struct FAcousticStreamedTile
+{
+    // Largest box of the listener's current tile loaded so far
+    FAcousticLoadedRegion LoadedRegion;
+    // Bounds of the listener's earlier tiles, which are still loaded
+    FBox StaleBounds = FBox(ForceInit);
+};
+
+// Per-listener state that only depends on the listener's location
+struct FAcousticListenerState
+{
+    FVector Location = FVector::ZeroVector;
+    // Set once per tick, claimed by whichever query thread refreshes outdoorness first
+    volatile int32 IsOutdoornessStale = 1;
+    // The bits of the outdoorness float. Written by that query thread while others read it, with only the read lock on
+    // the listeners held, so it is stored atomically.
+    volatile int32 OutdoornessBits = 0;
+};
+
+// An ACE file that is part of the loaded acoustic scene
+struct FAcousticAceFile
+{
+    FString FilePath;
+    // Loaded with LoadAceFile rather than added with AddAceFile
+    bool IsPrimary = false;
+    TUniquePtr<TritonRuntime::FTritonUnrealIOHook> IOHook;
+};
+
+// A Triton instance that is loaded on a background thread while the current one keeps answering queries, together
+// with everything it reads through. Once it has been swapped in, the same struct carries the previous instance to its
+// teardown.
+struct FAcousticAceSwap
+{
+    TritonRuntime::TritonAcoustics* Triton = nullptr;
+    TArray<FAcousticAceFile> AceFiles;
+    TUniquePtr<TritonRuntime::FTritonAsyncTaskHook> TaskHook;
+    float CacheScale = 1.0f;
+    // Clear the queries that are still in flight once the swap completes, see IAcoustics::UnloadAceFile
+    bool ClearOldQueries = false;
+    // Set once the background load has finished, true if it succeeded
+    TFuture<bool> LoadResult;
+};
+
+// A dynamic opening as it was registered, so that it can be registered again when the ACE files are reloaded
+struct FAcousticDynamicOpening
+{
+    FVector Center = FVector::ZeroVector;
+    FVector Normal = FVector::ZeroVector;
+    TArray<Triton::Vec3f> Vertices;
+    bool HasAttenuation = false;
+    float DryAttenuationDb = 0.0f;
+    float WetAttenuationDb = 0.0f;
+};
+
+// What to do with a source's background query on this update
+enum class EAcousticQueryDecision : uint8
+{
+    // Nothing changed enough to need a new query
+    Skip,
+    // Start the query right away
+    Run,
+    // Rank the query against the other sources and start it if it fits in the per-frame budget
+    Defer
+};
+
+// A query waiting to be ranked at the end of the audio tick. Its inputs are kept in the query slot.
+struct FDeferredAcousticQuery
+{
+    int32 SlotIndex;
+    int64 Generation;
+    float Importance;
+};
+
+// Inputs for all acoustic queries collected during one audio tick, stored as parallel arrays so that the query
+// workers can walk them linearly. Reset keeps the allocations around for the next tick.
+struct FAcousticQueryBatch
+{
+    // Index into the per-source query slots and the slot generation at the time the job was added. Results are
+    // dropped if the source was unregistered or re-registered before the batch completed.
+    TArray<int32> SourceSlots;
+    TArray<int64> SlotGenerations;
+    TArray<FVector> SourceLocations;
+    TArray<FVector> ListenerLocations;
+    TArray<TritonRuntime::InterpolationConfig> InterpolationConfigs;
+    TArray<TritonDynamicOpeningInfo> OpeningInfos;
+
+    int32 Num() const
+    {
+        return SourceSlots.Num();
+    }
+
+    int32 Add(const int32 sourceSlot, const int64 slotGeneration)
+    {
+        SourceLocations.AddUninitialized();
+        ListenerLocations.AddUninitialized();
+        InterpolationConfigs.AddUninitialized();
+        OpeningInfos.AddUninitialized();
+        SlotGenerations.Add(slotGeneration);
+        return SourceSlots.Add(sourceSlot);
+    }
+
+    void Set(
+        const int32 jobIndex, const int64 slotGeneration, const FVector& sourceLocation,
+        const FVector& listenerLocation, const AcousticsObjectParams& objectParams)
+    {
+        SlotGenerations[jobIndex] = slotGeneration;
+        SourceLocations[jobIndex] = sourceLocation;
+        ListenerLocations[jobIndex] = listenerLocation;
+        InterpolationConfigs[jobIndex] = objectParams.InterpolationConfig;
+        OpeningInfos[jobIndex] = objectParams.DynamicOpeningInfo;
+    }
+
+    void Reset()
+    {
+        SourceSlots.Reset();
+        SlotGenerations.Reset();
+        SourceLocations.Reset();
+        ListenerLocations.Reset();
+        InterpolationConfigs.Reset();
+        OpeningInfos.Reset();
+    }
 };
 
 class FProjectAcousticsModule : public IAcoustics
@@ -97,6 +296,8 @@ public:
     // IAcoustics
     virtual bool LoadAceFile(const FString& filePath, const float cacheScale) override;
     virtual void UnloadAceFile(bool clearOldQueries) override;
+    virtual bool AddAceFile(const FString& filePath, const float cacheScale) override;
+    virtual void RemoveAceFile(const FString& filePath) override;
 
     virtual bool AddDynamicOpening(
         class UAcousticsDynamicOpening* opening, const FVector& center, const FVector& normal,
@@ -105,6 +306,15 @@ public:
     virtual bool UpdateDynamicOpening(
         class UAcousticsDynamicOpening* opening, float dryAttenuationDb, float wetAttenuationDb) override;
 
+    virtual void AddRuntimeVolume(
+        class AAcousticsRuntimeVolume* volume, const uint32 worldId, const FBox& bounds,
+        const TArray<TArray<FPlane>>& hulls, const FAcousticsDesignParams& overrideParams) override;
+    virtual bool RemoveRuntimeVolume(class AAcousticsRuntimeVolume* volume) override;
+    virtual bool
+    UpdateRuntimeVolume(class AAcousticsRuntimeVolume* volume, const FAcousticsDesignParams& overrideParams) override;
+    virtual void ApplyRuntimeVolumeOverrides(
+        const uint32 worldId, const FVector& location, FAcousticsDesignParams& designParams) const override;
+
     virtual bool SetGlobalDesign(const FAcousticsDesignParams& params) override;
     virtual void SetSpaceTransform(const FTransform& newTransform) override;
 
@@ -115,22 +325,38 @@ public:
         const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
         AcousticsObjectParams objectParams);
 
+    virtual void SetMaxSources(const int32 maxSources) override;
     virtual void RegisterSourceObject(const uint64_t sourceObjectId) override;
     virtual void UnregisterSourceObject(const uint64_t sourceObjectId) override;
+    virtual void WarmUpQuery(
+        const FVector& sourceLocation, const FVector& listenerLocation,
+        const AcousticsObjectParams& objectParams) override;
 
+    virtual void SetListenerLocations(TArrayView<const FVector> listenerLocations) override;
     virtual bool UpdateOutdoorness(const FVector& listenerLocation) override;
     virtual float GetOutdoorness() const override;
+    virtual float GetOutdoornessForListener(const FVector& listenerLocation) const override;
     virtual bool CalculateReverbSendWeights(
         const float targetReverbTime, const uint32_t numReverbs, const float* reverbTimes,
         float* reverbSendWeights) const override;
 
     virtual bool PostTick() override;
+    virtual void PostAudioTick() override;
 
     virtual bool UpdateDistances(const FVector& listenerLocation) override;
     virtual bool QueryDistance(const FVector& lookDirection, float& outDistance) override;
     virtual void UpdateLoadedRegion(
         const FVector& playerPosition, const FVector& tileSize, const bool forceUpdate,
         const bool unloadProbesOutsideTile, const bool blockOnCompletion) override;
+    virtual void UpdateLoadedRegionPredictive(
+        const FVector& playerPosition, const FVector& playerVelocity, const float predictionTime,
+        const FVector& tileSize, const bool forceUpdate, const bool unloadProbesOutsideTile,
+        const bool blockOnCompletion) override;
+    virtual void UpdateLoadedRegions(
+        TArrayView<const FVector> listenerPositions, TArrayView<const FVector> listenerVelocities,
+        const float predictionTime, const FVector& tileSize, const bool forceUpdate,
+        const bool unloadProbesOutsideTile, const bool blockOnCompletion) override;
+    virtual FAcousticsTelemetry GetTelemetry() const override;
 
     virtual FVector TritonPositionToWorld(const FVector& vec) const override;
     virtual FVector WorldPositionToTriton(const FVector& vec) const override;
@@ -166,9 +392,35 @@ public:
         return m_TritonMemHook != nullptr ? m_TritonMemHook->GetTotalMemoryUsed() : 0;
     }
 
+    // The stats Triton collected over the last window. Returns false if there are none yet.
+    bool GetTritonStats(TritonRuntime::TritonStats& outStats) const
+    {
+        outStats = m_TritonStats;
+        return m_HasTritonStats;
+    }
+
+    float GetTileEvictionScale() const
+    {
+        return m_TileEvictionScale;
+    }
+
+    int64 GetMemoryReserved() const
+    {
+        return m_TritonMemHook != nullptr ? m_TritonMemHook->GetTotalMemoryReserved() : 0;
+    }
+
+    void GetMemoryScopes(TArray<TritonRuntime::FTritonMemHook::FScopeMemory>& outScopes) const
+    {
+        outScopes.Reset();
+        if (m_TritonMemHook != nullptr)
+        {
+            m_TritonMemHook->GetScopeMemory(outScopes);
+        }
+    }
+
     int64 GetDiskBytesRead() const
     {
-        return m_TritonIOHook != nullptr ? m_TritonIOHook->GetBytesRead() : 0;
+        return GetTotalBytesRead();
     }
 
 #endif
@@ -176,33 +428,111 @@ public:
 private:
     // Triton members
     TritonRuntime::TritonAcoustics* m_Triton;
+    // Held for reading by queries off the game thread, and for writing while m_Triton is swapped for a hot-swapped
+    // instance. The game thread is the only one that swaps, so it reads m_Triton without the lock.
+    mutable FRWLock m_TritonLock;
     bool m_TritonInstanceCreated;
     bool m_AceFileLoaded;
-    FVector m_LastLoadCenterPosition;
-    FVector m_LastLoadTileSize;
+    // The streamed tile around each listener, in the order the listeners were last given
+    TArray<FAcousticLoadedRegion> m_LoadedRegions;
+    // Paced streaming (see ProcessStreamingQueue). Tile loads wait in the queue until the budgets allow them.
+    TArray<FAcousticStreamingChunk> m_StreamingQueue;
+    TArray<FAcousticStreamedTile> m_StreamedTiles;
+    bool m_UnloadProbesOutsideTile;
+    // Where each listener was when its tile was last updated
+    TArray<FVector> m_TileListenerPositions;
+    // Tiles are scaled down by this while Triton is over PA.MemoryBudgetMB (see EnforceMemoryBudget)
+    float m_TileEvictionScale;
+    double m_LastEvictionTime;
+    // Telemetry, see GetTelemetry. Queries are counted from many threads at once.
+    FAcousticsShardedCounter m_NumQueries;
+    FAcousticsShardedCounter m_NumFailedQueries;
+    FAcousticsShardedCounter m_NumTileLoads;
+    FAcousticsShardedCounter m_NumFailedTileLoads;
+    FAcousticsShardedCounter m_NumProbesRequested;
+    FAcousticsShardedCounter m_NumEvictions;
+    // Triton's own stats over the last window, see UpdateTritonStats
+    TritonRuntime::TritonStats m_TritonStats;
+    bool m_HasTritonStats;
+    double m_LastTritonStatsTime;
+    // Bytes that can still be read under PA.StreamingBandwidthKBps. Negative while reads are over budget.
+    double m_StreamingBandwidthBudget;
+    double m_LastStreamingUpdateTime;
+    int64 m_LastStreamingBytesRead;
     TUniquePtr<TritonRuntime::FTritonMemHook> m_TritonMemHook;
     TUniquePtr<TritonRuntime::FTritonLogHook> m_TritonLogHook;
-    TUniquePtr<TritonRuntime::FTritonUnrealIOHook> m_TritonIOHook;
+    // The files combined into the Triton instance, primary file first. Their IO hooks stay open while the instance is
+    // re-initialized for a change to the set of files.
+    TArray<FAcousticAceFile> m_AceFiles;
+    float m_AceCacheScale;
     TUniquePtr<TritonRuntime::FTritonAsyncTaskHook> m_TritonTaskHook;
-    bool m_IsOutdoornessStale;
-    float m_CachedOutdoorness;
+    // The instance being loaded to replace m_Triton (PA.HotSwapAceFiles), if any
+    TUniquePtr<FAcousticAceSwap> m_PendingAceSwap;
+    // Instances that were replaced or superseded and are being torn down in the background
+    TArray<TFuture<void>> m_AceSwapTeardowns;
+    // Keyed by opening
+    TMap<uint64, FAcousticDynamicOpening> m_DynamicOpenings;
+    // Outdoorness for each listener. There is always at least one. The array is only resized by the game thread
+    // with the write lock held.
+    TArray<FAcousticListenerState> m_Listeners;
+    mutable FRWLock m_ListenersLock;
     FAcousticsDesignParams m_GlobalDesign;
     FTransform m_SpaceTransform;
     FTransform m_InverseSpaceTransform;
 
-    // Holds all async acoustic queries for each source before they've been returned to the caller
-    // Key is the sourceID, value is the acoustic query results
-    TMap<uint64_t, AsyncAcousticQueryResults> m_AcousticQueryResultMap;
+    // Query state for each source, indexed by source ID. Slots are heap allocated so that they keep their address
+    // when more are added, since queued work refers to them directly.
+    TArray<TUniquePtr<FAcousticQuerySlot>> m_QuerySlots;
+
+    // Thread pools responsible for running background acoustic queries. Each pool owns exactly one thread and every
+    // source is pinned to one of them (see GetQueryThreadPool), so queries for a given source always run in order
+    // while queries for different sources run in parallel. Pools are only destroyed on shutdown, so the audio thread
+    // can read the first m_NumActiveQueryThreadPools entries without a lock. Capacity is reserved up front so adding
+    // pools never reallocates.
+    TArray<FQueuedThreadPool*> m_QueryThreadPools;
+    volatile int32 m_NumActiveQueryThreadPools;
 
-    // Map for all access to m_AcousticQueryResultMap. This map can be accessed by the game/audio thread and the
-    // background thread responsible for doing acoustic queries
-    FCriticalSection m_AcousticQueryResultMapLock;
+    // Threads that run Triton's streaming tasks for every instance (PA.StreamingThreads). Game thread only.
+    FQueuedThreadPool* m_StreamingThreadPool;
 
-    // Thread pool responsible for maintaining our own pool of thread(s) for running background acoustic queries
-    FQueuedThreadPool* m_ThreadPool;
+    // The debug overload of QueryAcoustics is not const, so calls to it must be serialized across query workers
+    FCriticalSection m_DebugQueryLock;
+
+    // Results shared between nearby sources (PA.QueryCache)
+    FAcousticsQueryCache m_QueryCache;
+
+    // Runtime volumes in play, looked up by the audio thread for every source update
+    FAcousticsRuntimeVolumeIndex m_RuntimeVolumeIndex;
 
     // Keep track of how many background queries are queued or running
-    volatile int32 m_NumRunningTasks;
+    FAcousticsTaskCounter m_RunningTasks;
+
+    // Queries that can still be started this frame (PA.QueryBudgetPerFrame). Refilled every PostTick.
+    volatile int32 m_QueryBudgetRemaining;
+    // Queries competing for the budget this audio tick. Audio thread only.
+    TArray<FDeferredAcousticQuery> m_DeferredQueries;
+
+    // First queries that can still run on the audio thread this frame (PA.SyncQueryBudgetPerFrame). Refilled every
+    // PostTick.
+    volatile int32 m_SyncQueryBudgetRemaining;
+    // Fixed ring of warm-up queries. The game and audio threads claim the first idle one from m_NextWarmUpQuery on.
+    TArray<FAcousticWarmUpQuery> m_WarmUpQueries;
+    volatile int32 m_NextWarmUpQuery;
+
+    // Batched query state (PA.BatchQueries). Sources add their query to the pending batch as they update, and the
+    // whole batch is handed to the query workers at the end of the audio tick. Only one batch is in flight at a time;
+    // while it runs, the next one keeps collecting and only holds the latest inputs for each source.
+    FAcousticQueryBatch m_PendingQueryBatch;
+    FAcousticQueryBatch m_InFlightQueryBatch;
+    TArray<AcousticQueryResults> m_InFlightQueryBatchResults;
+    // One reusable work item per query worker, each processing the [Key, Value) job range at the same index
+    TArray<TUniquePtr<FAcousticsQueuedWork>> m_QueryBatchWork;
+    TArray<TPair<int32, int32>> m_QueryBatchChunkRanges;
+    bool m_IsQueryBatchInFlight;
+    // When the in-flight batch went to the query workers, in cycles
+    uint64 m_InFlightQueryBatchCycles;
+    // Most updates any source has gone without fresh results during this audio tick. Audio thread only.
+    int32 m_MaxUpdatesSinceFreshResult;
 
 #if !UE_BUILD_SHIPPING
     bool m_IsEnabled;
@@ -210,10 +540,75 @@ private:
 #endif
 
     // Helpers
+    AcousticQueryResults RunAcousticQuery(
+        const FVector& sourceLocation, const FVector& listenerLocation, const TritonDynamicOpeningInfo& openingInfo,
+        const TritonRuntime::InterpolationConfig& interpConfig);
+    bool UpdatePerSourceQuery(
+        const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
+        const AcousticsObjectParams& objectParams, AcousticQueryResults& outResults);
+    bool UpdateBatchedQuery(
+        const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
+        const AcousticsObjectParams& objectParams, AcousticQueryResults& outResults);
+    void ProcessQueryBatchChunk(const int32 chunkIndex);
+    void ProcessSlotQuery(FAcousticQuerySlot& slot);
+    bool StartWarmUpQuery(
+        const FVector& sourceLocation, const FVector& listenerLocation,
+        const TritonRuntime::InterpolationConfig& interpolationConfig);
+    void ProcessWarmUpQuery(const int32 warmUpIndex);
+    bool GetFirstQueryResults(
+        FAcousticQuerySlot& slot, const FVector& sourceLocation, const FVector& listenerLocation,
+        const AcousticsObjectParams& objectParams, AcousticQueryResults& outResults);
+    EAcousticQueryDecision ShouldScheduleQuery(
+        FAcousticQuerySlot& slot, const FVector& sourceLocation, const FVector& listenerLocation,
+        const AcousticsObjectParams& objectParams);
+    void DeferQuery(
+        FAcousticQuerySlot& slot, const FVector& sourceLocation, const FVector& listenerLocation,
+        const AcousticsObjectParams& objectParams);
+    void DispatchDeferredQueries();
+    void QueueSlotQuery(FAcousticQuerySlot& slot);
+    void MarkQueried(FAcousticQuerySlot& slot, const FVector& sourceLocation, const FVector& listenerLocation);
+    void MarkUpdated(FAcousticQuerySlot& slot, const bool hasFreshResults);
+    TritonAcousticParameters
+    SmoothAcousticParameters(const uint64_t sourceObjectId, const TritonAcousticParameters& latestParams);
+    FAcousticQuerySlot* FindQuerySlot(const uint64_t sourceObjectId) const;
+    void CollectQueryBatchResults();
+    int32 FindClosestListener(const FVector& listenerLocation) const;
+    TArray<FAcousticAceFile> GetTargetAceFiles() const;
+    float GetTargetAceCacheScale() const;
+    bool SetAceFiles(TArray<FAcousticAceFile>&& aceFiles, const float cacheScale, const bool clearOldQueries);
+    void ClearAceFiles(const bool clearOldQueries);
+    TUniquePtr<TritonRuntime::FTritonUnrealIOHook> OpenAceFile(const FString& filePath) const;
+    bool ReloadAceFiles(const float cacheScale);
+    bool StartAceSwap(TArray<FAcousticAceFile>&& aceFiles, const float cacheScale, bool clearOldQueries);
+    void UpdateAceSwap();
+    void CancelAceSwap();
+    void RetireAceSwap(TUniquePtr<FAcousticAceSwap>&& swap);
+    bool AddTritonDynamicOpening(
+        TritonRuntime::TritonAcoustics* triton, const uint64 openingId, const FAcousticDynamicOpening& opening);
+    int32 LoadTritonRegion(
+        TritonRuntime::TritonAcoustics* triton, const FAcousticLoadedRegion& region, const bool unloadOutside,
+        const bool blockOnCompletion);
+    void UnloadTritonBounds(const FBox& bounds);
+    bool IsStreamingPaced() const;
+    void ProcessStreamingQueue();
+    int32 IssueStreamingChunk(const FAcousticStreamingChunk& chunk, const bool releaseStale);
+    void ReloadStreamedTiles(const int32 exceptListenerIndex);
+    void ResetStreamedTiles();
+    bool UnloadStaleTiles();
+    void EnforceMemoryBudget();
+    void RestartTritonStats();
+    void UpdateTritonStats();
+    int64 GetTotalBytesRead() const;
     bool GetAcousticParameters(
         const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& params,
         TritonDynamicOpeningInfo& outOpeningInfo, const TritonRuntime::InterpolationConfig& radiationDir, TritonRuntime::QueryDebugInfo* outDebugInfo = nullptr);
     void WaitForRunningTasks();
+    void LogRunningTasks() const;
+    void RefreshQueryThreadPools();
+    void DestroyQueryThreadPools();
+    FQueuedThreadPool* GetQueryThreadPool(const uint64_t sourceObjectId) const;
+    FQueuedThreadPool* GetStreamingThreadPool();
+    void DestroyStreamingThreadPool();
 };
 
 // Statistics hooks
@@ -223,4 +618,41 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("Query Acoustics"), STAT_Acoustics_Query, STATGRO
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Query Outdoorness"), STAT_Acoustics_QueryOutdoorness, STATGROUP_Acoustics, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Load Region"), STAT_Acoustics_LoadRegion, STATGROUP_Acoustics, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Load Ace File"), STAT_Acoustics_LoadAce, STATGROUP_Acoustics, );
-DECLARE_CYCLE_STAT_EXTERN(TEXT("Clear Ace File"), STAT_Acoustics_ClearAce, STATGROUP_Acoustics, );
\ No newline at end of file
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Clear Ace File"), STAT_Acoustics_ClearAce, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Warm-Up Queries"), STAT_Acoustics_WarmUpQueries, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("First Queries On Audio Thread"), STAT_Acoustics_SyncFirstQueries, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("First Query Cache Hits"), STAT_Acoustics_FirstQueryCacheHits, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("First Query Cache Misses"), STAT_Acoustics_FirstQueryCacheMisses, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Streaming Queue Depth"), STAT_Acoustics_StreamingQueueDepth, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Streaming Bandwidth Backlog (KB)"), STAT_Acoustics_StreamingBacklogKB, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Streaming Probes Requested"), STAT_Acoustics_StreamingProbesRequested, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Memory Budget Evictions"), STAT_Acoustics_Evictions, STATGROUP_Acoustics, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Tile Eviction Scale"), STAT_Acoustics_TileEvictionScale, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Triton Probes In RAM"), STAT_Acoustics_TritonProbesInRAM, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Triton Probes Pending Load"), STAT_Acoustics_TritonProbesPendingLoad, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Triton Probes Pending Unload"), STAT_Acoustics_TritonProbesPendingUnload, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Triton Probes Loaded"), STAT_Acoustics_TritonProbesLoaded, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Triton Probe Load Failures"), STAT_Acoustics_TritonProbesLoadFailed, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Triton Probes Unloaded"), STAT_Acoustics_TritonProbesUnloaded, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Triton Failed Queries"), STAT_Acoustics_TritonFailedQueries, STATGROUP_Acoustics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT("Triton Streaming Failures"), STAT_Acoustics_TritonStreamingFailures, STATGROUP_Acoustics, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(
+    TEXT("Triton Avg Query Time"), STAT_Acoustics_TritonAvgQueryTime, STATGROUP_Acoustics, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(
+    TEXT("Triton Max Query Time"), STAT_Acoustics_TritonMaxQueryTime, STATGROUP_Acoustics, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(
+    TEXT("Triton Query Time Std Dev"), STAT_Acoustics_TritonStdDevQueryTime, STATGROUP_Acoustics, );
\ No newline at end of file
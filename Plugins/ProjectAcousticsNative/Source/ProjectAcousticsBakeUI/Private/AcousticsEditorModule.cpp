@@ -10,6 +10,8 @@
 #include "Settings/ProjectPackagingSettings.h"
 #include "AcousticsSharedState.h"
 #include "Styling/SlateStyle.h"
+#include "ISettingsModule.h"
+#include "AcousticsRuntimeSettings.h"
 
 #define LOCTEXT_NAMESPACE "FAcousticsEditorModule"
 
@@ -115,6 +117,19 @@ void FAcousticsEditorModule::StartupModule()
         PackagingSettings->UpdateDefaultConfigFile();
 #endif
     }
+
+    // Register the runtime settings for the ProjectAcoustics module
+    ISettingsModule* SettingsModule = FModuleManager::Get().GetModulePtr<ISettingsModule>("Settings");
+    if (SettingsModule)
+    {
+        SettingsModule->RegisterSettings(
+            "Project",
+            "Plugins",
+            "Project Acoustics Runtime",
+            LOCTEXT("RuntimeSettingsName", "Project Acoustics Runtime"),
+            LOCTEXT("RuntimeSettingsDescription", "Configure the Project Acoustics runtime"),
+            GetMutableDefault<UAcousticsRuntimeSettings>());
+    }
 }
 
 void FAcousticsEditorModule::ShutdownModule()
@@ -124,6 +139,12 @@ void FAcousticsEditorModule::ShutdownModule()
     FEditorModeRegistry::Get().UnregisterMode(FAcousticsEdMode::EM_AcousticsEdModeId);
     FSlateStyleRegistry::UnRegisterSlateStyle(StyleSet->GetStyleSetName());
 
+    ISettingsModule* SettingsModule = FModuleManager::Get().GetModulePtr<ISettingsModule>("Settings");
+    if (SettingsModule)
+    {
+        SettingsModule->UnregisterSettings("Project", "Plugins", "Project Acoustics Runtime");
+    }
+
     // AcousticsSharedState contains objects that depend on the DLL we are about to unload.
     AcousticsSharedState::Destroy();
 
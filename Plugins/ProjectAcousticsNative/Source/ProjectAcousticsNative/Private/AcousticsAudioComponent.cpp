@@ -13,6 +13,8 @@
 #include "Math/ConvexHull2d.h"
 #endif
 #include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
 #include "DrawDebugHelpers.h"
 
 UAcousticsAudioComponent::UAcousticsAudioComponent(const FObjectInitializer& ObjectInitializer)
@@ -31,6 +33,61 @@ FName UAcousticsAudioComponent::Name() const
     return o ? o->GetFName() : this->GetFName();
 }
 
+void UAcousticsAudioComponent::Play(float StartTime)
+{
+    WarmUpAcousticQuery();
+    Super::Play(StartTime);
+}
+
+void UAcousticsAudioComponent::WarmUpAcousticQuery() const
+{
+    if (!IAcoustics::IsAvailable())
+    {
+        return;
+    }
+
+    auto world = GetWorld();
+    if (world == nullptr)
+    {
+        return;
+    }
+
+    // The audio thread queries from the listener closest to the sound, so warm up from the same one. Otherwise the
+    // result lands in another cache cell than the one the first update looks in.
+    const auto sourceLocation = GetComponentLocation();
+    auto hasListener = false;
+    FVector listenerLocation = FVector::ZeroVector;
+    for (auto it = world->GetPlayerControllerIterator(); it; ++it)
+    {
+        auto pc = it->Get();
+        if (pc == nullptr || !pc->IsLocalController())
+        {
+            continue;
+        }
+
+        FVector location, front, right;
+        pc->GetAudioListenerPosition(location, front, right);
+        if (!hasListener ||
+            FVector::DistSquared(location, sourceLocation) < FVector::DistSquared(listenerLocation, sourceLocation))
+        {
+            listenerLocation = location;
+            hasListener = true;
+        }
+    }
+    if (!hasListener)
+    {
+        return;
+    }
+
+    auto& acoustics = IAcoustics::Get();
+    AcousticsObjectParams objectParams = {};
+    objectParams.ApplyDynamicOpenings = Settings.ApplyDynamicOpenings;
+    objectParams.InterpolationConfig = TritonRuntime::InterpolationConfig(
+        static_cast<TritonRuntime::InterpolationConfig::DisambiguationMode>(Settings.Resolver),
+        AcousticsUtils::ToTritonVector(acoustics.WorldDirectionToTriton(Settings.PushDirection)));
+    acoustics.WarmUpQuery(sourceLocation, listenerLocation, objectParams);
+}
+
 #if WITH_EDITOR
 bool UAcousticsAudioComponent::CanEditChange(const FProperty* InProperty) const
 {
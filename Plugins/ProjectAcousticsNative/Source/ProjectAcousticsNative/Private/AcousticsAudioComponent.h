@@ -35,10 +35,13 @@ public:
     }
 
     // Overridden methods
+    virtual void Play(float StartTime = 0.0f) override;
 #if WITH_EDITOR
     virtual bool CanEditChange(const FProperty* InProperty) const override;
 #endif
 
 private:
     FName Name() const;
+    // Start the acoustic query for this sound ahead of the audio thread needing it
+    void WarmUpAcousticQuery() const;
 };
\ No newline at end of file
@@ -4,13 +4,11 @@
 #include "AcousticsSourceDataOverride.h"
 #include "IAcoustics.h"
 #include "Engine/World.h"
-#include "Engine/OverlapResult.h"
 #include "MathUtils.h"
 #include "AcousticsSourceDataOverrideSettings.h"
 #include "Sound/SoundEffectSubmix.h"
 #include "Sound/SoundSubmix.h"
 #include "SubmixEffects/AudioMixerSubmixEffectReverb.h"
-#include "AcousticsRuntimeVolume.h"
 #include "AcousticsShared.h"
 #include "AcousticsParameterInterface.h"
 #include "AcousticsSourceBufferListener.h"
@@ -18,6 +16,18 @@
 #include "Components/AudioComponent.h"
 #include "ProjectAcousticsLogChannels.h"
 
+// MetaSound inputs, in the order of FAcousticsSourceState::MetaSoundParams
+static const FName* const c_MetaSoundParamNames[c_NumMetaSoundParams] = {
+    &AcousticsParameterInterface::Inputs::DryArrivalAzimuth,
+    &AcousticsParameterInterface::Inputs::DryArrivalElevation,
+    &AcousticsParameterInterface::Inputs::WetArrivalAzimuth,
+    &AcousticsParameterInterface::Inputs::WetArrivalElevation,
+    &AcousticsParameterInterface::Inputs::DryLoudness,
+    &AcousticsParameterInterface::Inputs::DryPathLength,
+    &AcousticsParameterInterface::Inputs::WetLoudness,
+    &AcousticsParameterInterface::Inputs::WetAngularSpread,
+    &AcousticsParameterInterface::Inputs::WetDecayTime};
+
 FAcousticsSourceDataOverride::FAcousticsSourceDataOverride()
     : m_Acoustics(nullptr)
     , m_IsStereoReverbInitialized(false)
@@ -43,10 +53,19 @@ void FAcousticsSourceDataOverride::Initialize(const FAudioPluginInitializationPa
                  "communicating with the acoustics engine."));
     }
 
-    m_LastSuccessfulQueryMap.Reset();
-
-    // Allocate settings for max sources
+    // Allocate settings and state for max sources
     m_SourceSettings.Init(nullptr, InitializationParams.NumSources);
+    m_SourceStates.Reset();
+    m_SourceStates.SetNum(InitializationParams.NumSources);
+    m_SourceNames.Reset(InitializationParams.NumSources);
+    for (auto i = 0; i < InitializationParams.NumSources; i++)
+    {
+        m_SourceNames.Add(FName(FString::Printf(TEXT("Source_%d"), i)));
+    }
+    if (m_Acoustics != nullptr)
+    {
+        m_Acoustics->SetMaxSources(InitializationParams.NumSources);
+    }
 
     // Process the reverb settings
     auto settings = GetDefault<UAcousticsSourceDataOverrideSettings>();
@@ -165,6 +184,13 @@ void FAcousticsSourceDataOverride::OnInitSource(
 {
     bool showAcousticParameters = false;
 
+    // Start over from a clean state, the previous source in this slot may have played something else
+    // The parameter array keeps its allocation for the next sound played on this source
+    auto metaSoundParamsToSend = MoveTemp(m_SourceStates[SourceId].MetaSoundParamsToSend);
+    m_SourceStates[SourceId] = FAcousticsSourceState();
+    m_SourceStates[SourceId].MetaSoundParamsToSend = MoveTemp(metaSoundParamsToSend);
+    m_SourceStates[SourceId].MetaSoundParamsToSend.Reset();
+
     if (InSettings)
     {
         // Save the settings for this source
@@ -193,7 +219,7 @@ void FAcousticsSourceDataOverride::OnReleaseSource(const uint32 SourceId)
 {
     bool showAcousticParameters = false;
 
-    m_LastSuccessfulQueryMap.Remove(SourceId);
+    m_SourceStates[SourceId].HasLastSuccessfulQuery = false;
 
     if (IsValid(m_SourceSettings[SourceId]))
     {
@@ -216,39 +242,6 @@ void FAcousticsSourceDataOverride::OnReleaseSource(const uint32 SourceId)
     m_SourceSettings[SourceId] = nullptr;
 }
 
-void FAcousticsSourceDataOverride::ApplyAcousticsDesignParamsOverrides(
-    UWorld* world, FVector sourceLocation, FAcousticsDesignParams& designParams)
-{
-    if (IsValid(world))
-    {
-        TArray<FOverlapResult> OverlapResults;
-        FCollisionQueryParams Params(SCENE_QUERY_STAT(AddForceOverlap), false);
-
-        if (world->OverlapMultiByObjectType(
-                OverlapResults,
-                sourceLocation,
-                FQuat::Identity,
-                FCollisionObjectQueryParams(ECC_WorldStatic),
-                FCollisionShape::MakeSphere(0.0f),
-                Params))
-        {
-            for (const FOverlapResult& OverlapResult : OverlapResults)
-            {
-                AAcousticsRuntimeVolume* AcousticsRuntimeVolume =
-                    Cast<AAcousticsRuntimeVolume>(OverlapResult.GetActor());
-
-                if (IsValid(AcousticsRuntimeVolume))
-                {
-                    auto overrideParams = AcousticsRuntimeVolume->OverrideDesignParams;
-
-                    // Apply the override parameters and save to the object's design params
-                    FAcousticsDesignParams::Combine(designParams, overrideParams);
-                }
-            }
-        }
-    }
-}
-
 // For a given direction from a listener, returns the Azimuth and Elevation in an orientation that is common to
 // MetaSounds
 void GetMetaSoundAzimuthAndElevation(
@@ -274,16 +267,25 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
     objectParams.ObjectId = SourceId;
     objectParams.Design = FAcousticsDesignParams::Default();
     objectParams.DynamicOpeningInfo = {};
-    FName SourceName = GetSourceName(SourceId);
+    objectParams.QueryPriority = 0.0f;
+    auto& sourceState = m_SourceStates[SourceId];
     bool enablePortaling = true;
     bool enableOcclusion = true;
     bool enableReverb = true;
     bool showAcousticParameters = false;
     bool applyAcousticsVolumes = true;
 
-    // Get source and listener location
+    // Get source and listener location. With several listeners, such as in split-screen, the sound is heard by the
+    // one closest to it, so its acoustics are computed from there.
     auto sourceLocation = InOutWaveInstance->Location;
-    auto listenerLocation = InListenerTransform.GetLocation();
+    auto listenerTransform = InListenerTransform;
+    auto audioDevice = InOutWaveInstance->ActiveSound->AudioDevice;
+    if (audioDevice != nullptr && audioDevice->GetListeners().Num() > 1)
+    {
+        const auto listenerIndex = audioDevice->FindClosestListenerIndex(FTransform(sourceLocation));
+        audioDevice->GetListenerTransform(listenerIndex, listenerTransform);
+    }
+    auto listenerLocation = listenerTransform.GetLocation();
 
     // Save the shared per-source settings if there are any
     auto sourceSettings = m_SourceSettings[SourceId];
@@ -300,6 +302,7 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
             AcousticsUtils::ToTritonVector(
                 m_Acoustics->WorldDirectionToTriton(sourceSettings->Settings.PushDirection)));
         objectParams.ApplyDynamicOpenings = sourceSettings->Settings.ApplyDynamicOpenings;
+        objectParams.QueryPriority = sourceSettings->Settings.QueryPriority;
     }
 
     // Grab the audio component belonging to this sound source
@@ -325,6 +328,7 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
                 static_cast<TritonRuntime::InterpolationConfig::DisambiguationMode>(aac->Settings.Resolver),
                 AcousticsUtils::ToTritonVector(m_Acoustics->WorldDirectionToTriton(aac->Settings.PushDirection)));
             objectParams.ApplyDynamicOpenings = aac->Settings.ApplyDynamicOpenings;
+            objectParams.QueryPriority = aac->Settings.QueryPriority;
         }
     }
 
@@ -333,10 +337,11 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
         objectParams.DynamicOpeningInfo.ApplyDynamicOpening = true;
     }
 
+    // Runtime volumes register with the acoustics module, which looks them up without a physics query
     if (applyAcousticsVolumes)
     {
-        ApplyAcousticsDesignParamsOverrides(
-            InOutWaveInstance->ActiveSound->GetWorld(), sourceLocation, objectParams.Design);
+        m_Acoustics->ApplyRuntimeVolumeOverrides(
+            InOutWaveInstance->ActiveSound->GetWorldID(), sourceLocation, objectParams.Design);
     }
 
     // Run the acoustic query
@@ -346,23 +351,25 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
     // If failed, try to grab the last successful query
     if (!acousticQuerySuccess)
     {
-        if (m_LastSuccessfulQueryMap.Contains(SourceId))
+        if (sourceState.HasLastSuccessfulQuery)
         {
-            objectParams.TritonParams = m_LastSuccessfulQueryMap[SourceId].TritonParams;
-            objectParams.Outdoorness = m_LastSuccessfulQueryMap[SourceId].Outdoorness;
-            objectParams.DynamicOpeningInfo = m_LastSuccessfulQueryMap[SourceId].DynamicOpeningInfo;
-            objectParams.Design = m_LastSuccessfulQueryMap[SourceId].Design;
+            const auto& lastQuery = sourceState.LastSuccessfulQuery;
+            objectParams.TritonParams = lastQuery.TritonParams;
+            objectParams.Outdoorness = lastQuery.Outdoorness;
+            objectParams.DynamicOpeningInfo = lastQuery.DynamicOpeningInfo;
+            objectParams.Design = lastQuery.Design;
             acousticQuerySuccess = true;
         }
     }
-    // Update last successful query map
+    // Update last successful query
     else
     {
-        m_LastSuccessfulQueryMap.Add(SourceId, objectParams);
+        sourceState.LastSuccessfulQuery = objectParams;
+        sourceState.HasLastSuccessfulQuery = true;
     }
 
 #if !UE_BUILD_SHIPPING
-    m_Acoustics->UpdateSourceDebugInfo(SourceId, showAcousticParameters, SourceName, false);
+    m_Acoustics->UpdateSourceDebugInfo(SourceId, showAcousticParameters, GetSourceName(SourceId), false);
 #endif
 
     if (!acousticQuerySuccess)
@@ -370,12 +377,15 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
         return;
     }
 
-    auto acousticParams = objectParams.TritonParams;
+    const auto& acousticParams = objectParams.TritonParams;
 
-    Audio::FParameterInterfacePtr paInterface = AcousticsParameterInterface::GetInterface();
-    TArray<FAudioParameter> paramsToUpdate;
-    // See if the current sound is a MetaSound
-    const bool isMetaSound = InOutWaveInstance->ActiveSound->GetSound()->ImplementsParameterInterface(paInterface);
+    // See if the current sound is a MetaSound. A source keeps playing the same sound, so this is only checked once.
+    if (!sourceState.HasCheckedMetaSound)
+    {
+        Audio::FParameterInterfacePtr paInterface = AcousticsParameterInterface::GetInterface();
+        sourceState.IsMetaSound = InOutWaveInstance->ActiveSound->GetSound()->ImplementsParameterInterface(paInterface);
+        sourceState.HasCheckedMetaSound = true;
+    }
 
     // Arrival direction for dry sound, including geometry
     FVector portalDir =
@@ -392,7 +402,7 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
 
         // Specific math we need to get the azimuth in the expected range
         // Azimuth: 0 front, 90 right, 180 behind, 270 left
-        auto directionNormal = InListenerTransform.InverseTransformVectorNoScale(portalDir);
+        auto directionNormal = listenerTransform.InverseTransformVectorNoScale(portalDir);
         auto SourceAzimuthAndElevation = FMath::GetAzimuthAndElevation(
             directionNormal, FVector::ForwardVector, FVector::RightVector, FVector::UpVector);
         auto Azimuth = FMath::RadiansToDegrees(SourceAzimuthAndElevation.X);
@@ -433,46 +443,84 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
             InOutWaveInstance);
     }
 
-    if (isMetaSound)
-    {
-        // Store the rest of the acoustic parameters for the MetaSound parameter update
-
-        // Get dry azimuth and elevation
-        float dryAzimuth = 0.0f, dryElevation = 0.0f;
-        GetMetaSoundAzimuthAndElevation(InListenerTransform, portalDir, dryAzimuth, dryElevation);
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::DryArrivalAzimuth, dryAzimuth});
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::DryArrivalElevation, dryElevation});
-
-        // Get wet azimuth and elevation
-        float wetAzimuth = 0.0f, wetElevation = 0.0f;
-        FVector reverbDir =
-            m_Acoustics->TritonDirectionToWorld(AcousticsUtils::ToFVector(acousticParams.Wet.ArrivalDirection));
-        GetMetaSoundAzimuthAndElevation(InListenerTransform, reverbDir, wetAzimuth, wetElevation);
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::WetArrivalAzimuth, wetAzimuth});
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::WetArrivalElevation, wetElevation});
-
-        // Store the rest of the acoustic parameters
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::DryLoudness, acousticParams.Dry.LoudnessDb});
-        paramsToUpdate.Add(
-            {AcousticsParameterInterface::Inputs::DryPathLength,
-             AcousticsUtils::TritonValToUnreal(acousticParams.Dry.PathLengthMeters)});
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::WetLoudness, acousticParams.Wet.LoudnessDb});
-        paramsToUpdate.Add(
-            {AcousticsParameterInterface::Inputs::WetAngularSpread, acousticParams.Wet.AngularSpreadDegrees});
-        paramsToUpdate.Add({AcousticsParameterInterface::Inputs::WetDecayTime, acousticParams.Wet.DecayTimeSeconds});
-
-        // Send the parameters to the MetaSound interface
-        auto paramTransmitter = InOutWaveInstance->ActiveSound->GetTransmitter();
-        if (paramTransmitter != nullptr)
+    if (sourceState.IsMetaSound)
+    {
+        UpdateMetaSoundParameters(sourceState, listenerTransform, portalDir, acousticParams, InOutWaveInstance);
+    }
+}
+
+// Sends the acoustic parameters to a MetaSound implementing the Project Acoustics interface. MetaSound inputs keep
+// their value until set again, so only the parameters that changed since the last update are sent.
+void FAcousticsSourceDataOverride::UpdateMetaSoundParameters(
+    FAcousticsSourceState& sourceState, const FTransform& InListenerTransform, const FVector& portalDir,
+    const TritonAcousticParameters& acousticParams, FWaveInstance* InOutWaveInstance)
+{
+    auto paramTransmitter = InOutWaveInstance->ActiveSound->GetTransmitter();
+    if (paramTransmitter == nullptr)
+    {
+        return;
+    }
+
+    float params[c_NumMetaSoundParams];
+
+    // Get dry azimuth and elevation
+    GetMetaSoundAzimuthAndElevation(InListenerTransform, portalDir, params[0], params[1]);
+
+    // Get wet azimuth and elevation
+    FVector reverbDir =
+        m_Acoustics->TritonDirectionToWorld(AcousticsUtils::ToFVector(acousticParams.Wet.ArrivalDirection));
+    GetMetaSoundAzimuthAndElevation(InListenerTransform, reverbDir, params[2], params[3]);
+
+    // Store the rest of the acoustic parameters
+    params[4] = acousticParams.Dry.LoudnessDb;
+    params[5] = AcousticsUtils::TritonValToUnreal(acousticParams.Dry.PathLengthMeters);
+    params[6] = acousticParams.Wet.LoudnessDb;
+    params[7] = acousticParams.Wet.AngularSpreadDegrees;
+    params[8] = acousticParams.Wet.DecayTimeSeconds;
+
+    auto& paramsToUpdate = sourceState.MetaSoundParamsToSend;
+    CollectChangedMetaSoundParameters(sourceState, params, paramsToUpdate);
+    if (paramsToUpdate.Num() == 0)
+    {
+        return;
+    }
+
+    // Send the parameters to the MetaSound interface. The transmitter moves the parameters out, and the emptied array
+    // is reused next time unless it took the allocation along.
+    paramTransmitter->SetParameters(MoveTemp(paramsToUpdate));
+    paramsToUpdate.Reset();
+}
+
+void FAcousticsSourceDataOverride::CollectChangedMetaSoundParameters(
+    FAcousticsSourceState& sourceState, const float (&params)[c_NumMetaSoundParams],
+    TArray<FAudioParameter>& outParams)
+{
+    outParams.Reset();
+    for (auto i = 0; i < c_NumMetaSoundParams; i++)
+    {
+        if (!sourceState.HasSentMetaSoundParams || params[i] != sourceState.MetaSoundParams[i])
         {
-            paramTransmitter->SetParameters(MoveTemp(paramsToUpdate));
+            // Room for every parameter the first time, so the array never grows after that
+            if (outParams.Max() < c_NumMetaSoundParams)
+            {
+                outParams.Reserve(c_NumMetaSoundParams);
+            }
+            outParams.Emplace(*c_MetaSoundParamNames[i], params[i]);
+            sourceState.MetaSoundParams[i] = params[i];
         }
     }
+    sourceState.HasSentMetaSoundParams = true;
 }
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
 void FAcousticsSourceDataOverride::OnAllSourcesProcessed()
 {
+    // Kick off any acoustic queries that were batched up while updating the sources
+    if (m_Acoustics != nullptr)
+    {
+        m_Acoustics->PostAudioTick();
+    }
+
     if (IsSpatialReverbInitialized())
     {
         m_SpatialReverb->ProcessAllSources();
@@ -600,12 +648,54 @@ void FAcousticsSourceDataOverride::ProcessReverb(
         m_MediumOutdoorSubmixSend.SendLevel = m_ReverbBusWeights[1] * outdoorGain;
         m_LongOutdoorSubmixSend.SendLevel = m_ReverbBusWeights[2] * outdoorGain;
 
-        // Add reverb submix buses to the WaveInstance object
-        InOutWaveInstance->SoundSubmixSends.Add(m_ShortIndoorSubmixSend);
-        InOutWaveInstance->SoundSubmixSends.Add(m_MediumIndoorSubmixSend);
-        InOutWaveInstance->SoundSubmixSends.Add(m_LongIndoorSubmixSend);
-        InOutWaveInstance->SoundSubmixSends.Add(m_ShortOutdoorSubmixSend);
-        InOutWaveInstance->SoundSubmixSends.Add(m_MediumOutdoorSubmixSend);
-        InOutWaveInstance->SoundSubmixSends.Add(m_LongOutdoorSubmixSend);
+        AddReverbSubmixSends(m_SourceStates[SourceId], InOutWaveInstance);
+    }
+}
+
+// Adds the reverb submix buses to the WaveInstance object. The engine may rebuild the wave instance's sends from the
+// sound on any update, so the reverb sends are added again whenever they aren't where the last update put them.
+void FAcousticsSourceDataOverride::AddReverbSubmixSends(
+    FAcousticsSourceState& sourceState, FWaveInstance* InOutWaveInstance)
+{
+    const FSoundSubmixSendInfo* const reverbSends[c_NumReverbSubmixSends] = {
+        &m_ShortIndoorSubmixSend,
+        &m_MediumIndoorSubmixSend,
+        &m_LongIndoorSubmixSend,
+        &m_ShortOutdoorSubmixSend,
+        &m_MediumOutdoorSubmixSend,
+        &m_LongOutdoorSubmixSend};
+    ApplyReverbSubmixSends(sourceState, reverbSends, InOutWaveInstance->SoundSubmixSends);
+}
+
+void FAcousticsSourceDataOverride::ApplyReverbSubmixSends(
+    FAcousticsSourceState& sourceState, const FSoundSubmixSendInfo* const (&reverbSends)[c_NumReverbSubmixSends],
+    TArray<FSoundSubmixSendInfo>& sends)
+{
+    // Only the sends this plugin appended are updated in place. A send authored on the sound can go to the same
+    // submix, and its level is the designer's.
+    const auto index = sourceState.ReverbSendsIndex;
+    auto areSendsInPlace = index != INDEX_NONE && index + c_NumReverbSubmixSends == sends.Num();
+    for (auto i = 0; areSendsInPlace && i < c_NumReverbSubmixSends; i++)
+    {
+        const auto& send = sends[index + i];
+        areSendsInPlace =
+            send.SoundSubmix == reverbSends[i]->SoundSubmix && send.SendStage == reverbSends[i]->SendStage;
+    }
+
+    if (areSendsInPlace)
+    {
+        for (auto i = 0; i < c_NumReverbSubmixSends; i++)
+        {
+            sends[index + i].SendLevel = reverbSends[i]->SendLevel;
+        }
+        return;
+    }
+
+    // Grow the array once rather than once per send
+    sourceState.ReverbSendsIndex = sends.Num();
+    sends.Reserve(sends.Num() + c_NumReverbSubmixSends);
+    for (const auto reverbSend : reverbSends)
+    {
+        sends.Add(*reverbSend);
     }
 }
@@ -7,6 +7,7 @@
 #include "AudioMixerDevice.h"
 #include "DSP/FloatArrayMath.h"
 #include "ProjectAcousticsLogChannels.h"
+#include "AcousticsTrace.h"
 
 FAcousticsSpatialReverb::FAcousticsSpatialReverb() :
     m_HrtfFrameCount(0)
@@ -185,6 +186,8 @@ void FAcousticsSpatialReverb::ProcessAllSources()
         return;
     }
 
+    ACOUSTICS_TRACE_SCOPE("Acoustics::HrtfProcessAllSources");
+
     auto outputBufferLength = m_NumOutputChannels * m_HrtfFrameCount;
 
     // Run through HrtfEngine
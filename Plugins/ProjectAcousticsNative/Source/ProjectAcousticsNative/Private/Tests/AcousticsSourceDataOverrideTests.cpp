@@ -0,0 +1,212 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsSourceDataOverride.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // Counts the allocations made by one thread while it is installed as GMalloc. Everything is forwarded to the
+    // allocator it replaced, so memory can move freely between the two.
+    class FAllocationCountingMalloc : public FMalloc
+    {
+    public:
+        explicit FAllocationCountingMalloc(FMalloc* inner)
+            : m_Inner(inner), m_ThreadId(FPlatformTLS::GetCurrentThreadId()), m_NumAllocations(0)
+        {
+        }
+
+        virtual void* Malloc(SIZE_T count, uint32 alignment) override
+        {
+            CountAllocation();
+            return m_Inner->Malloc(count, alignment);
+        }
+
+        virtual void* TryMalloc(SIZE_T count, uint32 alignment) override
+        {
+            CountAllocation();
+            return m_Inner->TryMalloc(count, alignment);
+        }
+
+        virtual void* Realloc(void* original, SIZE_T count, uint32 alignment) override
+        {
+            CountAllocation();
+            return m_Inner->Realloc(original, count, alignment);
+        }
+
+        virtual void* TryRealloc(void* original, SIZE_T count, uint32 alignment) override
+        {
+            CountAllocation();
+            return m_Inner->TryRealloc(original, count, alignment);
+        }
+
+        virtual void Free(void* original) override
+        {
+            m_Inner->Free(original);
+        }
+
+        virtual SIZE_T QuantizeSize(SIZE_T count, uint32 alignment) override
+        {
+            return m_Inner->QuantizeSize(count, alignment);
+        }
+
+        virtual bool GetAllocationSize(void* original, SIZE_T& outSize) override
+        {
+            return m_Inner->GetAllocationSize(original, outSize);
+        }
+
+        virtual bool IsInternallyThreadSafe() const override
+        {
+            return m_Inner->IsInternallyThreadSafe();
+        }
+
+        virtual const TCHAR* GetDescriptiveName() override
+        {
+            return TEXT("AcousticsAllocationCounter");
+        }
+
+        int32 GetNumAllocations() const
+        {
+            return FPlatformAtomics::AtomicRead(&m_NumAllocations);
+        }
+
+    private:
+        void CountAllocation()
+        {
+            if (FPlatformTLS::GetCurrentThreadId() == m_ThreadId)
+            {
+                FPlatformAtomics::InterlockedIncrement(&m_NumAllocations);
+            }
+        }
+
+        FMalloc* m_Inner;
+        uint32 m_ThreadId;
+        volatile int32 m_NumAllocations;
+    };
+
+    // Installs an allocation counter for the calling thread for as long as it lives
+    class FScopedAllocationCounter
+    {
+    public:
+        FScopedAllocationCounter() : m_Counter(GMalloc), m_Previous(GMalloc)
+        {
+            GMalloc = &m_Counter;
+        }
+
+        ~FScopedAllocationCounter()
+        {
+            GMalloc = m_Previous;
+        }
+
+        int32 GetNumAllocations() const
+        {
+            return m_Counter.GetNumAllocations();
+        }
+
+    private:
+        FAllocationCountingMalloc m_Counter;
+        FMalloc* m_Previous;
+    };
+
+    constexpr int32 c_NumSteadyStateUpdates = 100;
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsMetaSoundParametersAllocationTest, "ProjectAcoustics.SourceDataOverride.MetaSoundParametersDontAllocate",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsMetaSoundParametersAllocationTest::RunTest(const FString& Parameters)
+{
+    FAcousticsSourceState sourceState;
+    TArray<FAudioParameter> paramsToSend;
+    float params[c_NumMetaSoundParams] = {};
+
+    // The first update sends everything and sizes the array
+    FAcousticsSourceDataOverride::CollectChangedMetaSoundParameters(sourceState, params, paramsToSend);
+    TestEqual(TEXT("First update sends every parameter"), paramsToSend.Num(), c_NumMetaSoundParams);
+
+    int32 numAllocations = 0;
+    int32 numUnchangedSent = 0;
+    int32 numChangedSent = 0;
+    {
+        FScopedAllocationCounter counter;
+        // Settled source, nothing to send
+        for (auto i = 0; i < c_NumSteadyStateUpdates; i++)
+        {
+            FAcousticsSourceDataOverride::CollectChangedMetaSoundParameters(sourceState, params, paramsToSend);
+            numUnchangedSent += paramsToSend.Num();
+        }
+        // Moving listener with temporal smoothing, every parameter changes on every update
+        for (auto i = 0; i < c_NumSteadyStateUpdates; i++)
+        {
+            for (auto& param : params)
+            {
+                param += 1.0f;
+            }
+            FAcousticsSourceDataOverride::CollectChangedMetaSoundParameters(sourceState, params, paramsToSend);
+            numChangedSent += paramsToSend.Num();
+        }
+        numAllocations = counter.GetNumAllocations();
+    }
+
+    TestEqual(TEXT("Unchanged parameters aren't sent"), numUnchangedSent, 0);
+    TestEqual(TEXT("Changed parameters are sent"), numChangedSent, c_NumSteadyStateUpdates * c_NumMetaSoundParams);
+    TestEqual(TEXT("Allocations in steady state"), numAllocations, 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsReverbSendsTest, "ProjectAcoustics.SourceDataOverride.ReverbSendsKeepAuthoredSends",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsReverbSendsTest::RunTest(const FString& Parameters)
+{
+    FSoundSubmixSendInfo reverbSendInfos[c_NumReverbSubmixSends];
+    const FSoundSubmixSendInfo* reverbSends[c_NumReverbSubmixSends];
+    for (auto i = 0; i < c_NumReverbSubmixSends; i++)
+    {
+        reverbSendInfos[i].SendStage =
+            i % 2 == 0 ? ESubmixSendStage::PreDistanceAttenuation : ESubmixSendStage::PostDistanceAttenuation;
+        reverbSends[i] = &reverbSendInfos[i];
+    }
+
+    // A send authored on the sound, going the same way as the first reverb send
+    FSoundSubmixSendInfo authoredSend = reverbSendInfos[0];
+    authoredSend.SendLevel = 0.5f;
+    TArray<FSoundSubmixSendInfo> sends;
+    sends.Add(authoredSend);
+
+    FAcousticsSourceState sourceState;
+    FAcousticsSourceDataOverride::ApplyReverbSubmixSends(sourceState, reverbSends, sends);
+    TestEqual(TEXT("Reverb sends are appended"), sends.Num(), 1 + c_NumReverbSubmixSends);
+
+    int32 numAllocations = 0;
+    {
+        FScopedAllocationCounter counter;
+        for (auto i = 0; i < c_NumSteadyStateUpdates; i++)
+        {
+            for (auto& send : reverbSendInfos)
+            {
+                send.SendLevel = static_cast<float>(i) / c_NumSteadyStateUpdates;
+            }
+            FAcousticsSourceDataOverride::ApplyReverbSubmixSends(sourceState, reverbSends, sends);
+        }
+        numAllocations = counter.GetNumAllocations();
+    }
+
+    TestEqual(TEXT("Reverb sends aren't added twice"), sends.Num(), 1 + c_NumReverbSubmixSends);
+    TestEqual(TEXT("Authored send level is kept"), sends[0].SendLevel, 0.5f);
+    TestEqual(TEXT("Reverb send level is updated"), sends[1].SendLevel, reverbSendInfos[0].SendLevel);
+    TestEqual(TEXT("Allocations in steady state"), numAllocations, 0);
+
+    // The engine rebuilt the sends from the sound, so they are appended again
+    sends.SetNum(1);
+    FAcousticsSourceDataOverride::ApplyReverbSubmixSends(sourceState, reverbSends, sends);
+    TestEqual(TEXT("Reverb sends are appended after a rebuild"), sends.Num(), 1 + c_NumReverbSubmixSends);
+    TestEqual(TEXT("Authored send level is kept after a rebuild"), sends[0].SendLevel, 0.5f);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
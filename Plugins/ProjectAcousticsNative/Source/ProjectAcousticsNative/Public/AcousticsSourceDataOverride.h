@@ -5,11 +5,38 @@
 
 #include "IAudioExtensionPlugin.h"
 #include "AudioDevice.h"
+#include "AudioParameter.h"
 #include "IAcoustics.h"
 #include "AcousticsSpatialReverb.h"
 #include "AcousticsSourceDataOverrideSourceSettings.h"
 #include "AcousticsSourceDataOverrideSettings.h"
 
+// Number of acoustic parameters sent to MetaSounds implementing the Project Acoustics interface
+constexpr int32 c_NumMetaSoundParams = 9;
+// Number of reverb submix sends added to every source by the stereo convolution reverb
+constexpr int32 c_NumReverbSubmixSends = 6;
+
+// Per-source state, preallocated for every source the audio mixer can play at once so that updating a source
+// doesn't allocate
+struct FAcousticsSourceState
+{
+    // The last successful query. If a query fails, we can instead use the last successful query.
+    AcousticsObjectParams LastSuccessfulQuery = {};
+    bool HasLastSuccessfulQuery = false;
+
+    // Whether the sound implements the Project Acoustics MetaSound interface. Checked on the first update.
+    bool HasCheckedMetaSound = false;
+    bool IsMetaSound = false;
+    // Values last sent to the MetaSound, in the order of c_MetaSoundParamNames, so only changes are sent
+    float MetaSoundParams[c_NumMetaSoundParams] = {};
+    bool HasSentMetaSoundParams = false;
+    // Reused for every MetaSound update. Only grows again if the transmitter takes its allocation.
+    TArray<FAudioParameter> MetaSoundParamsToSend;
+
+    // Where the reverb sends were appended to the wave instance's sends on the last update, INDEX_NONE if nowhere
+    int32 ReverbSendsIndex = INDEX_NONE;
+};
+
 class FAcousticsSourceDataOverride : public IAudioSourceDataOverride
 {
 public:
@@ -41,23 +68,40 @@ public:
                m_IsSpatialReverbInitialized;
     }
 
+    // Parts of the per-source update that don't need a running audio mixer, public for the automation tests
+
+    // Collects the parameters that changed since they were last sent into outParams, and records them as sent
+    static void CollectChangedMetaSoundParameters(
+        FAcousticsSourceState& sourceState, const float (&params)[c_NumMetaSoundParams],
+        TArray<FAudioParameter>& outParams);
+    // Adds the reverb sends to sends, or only updates their levels if they are still where the last update put them.
+    // Sends authored on the sound are never touched, even when they go to the same submix.
+    static void ApplyReverbSubmixSends(
+        FAcousticsSourceState& sourceState, const FSoundSubmixSendInfo* const (&reverbSends)[c_NumReverbSubmixSends],
+        TArray<FSoundSubmixSendInfo>& sends);
+
 private:
-    void
-    ApplyAcousticsDesignParamsOverrides(UWorld* world, FVector listenerLocation, FAcousticsDesignParams& designParams);
     void ProcessReverb(
         const uint32 SourceId, const bool enablePortaling, const FVector& listenerLocation,
         const float occlusionDbDesigned, const float occlusionDbActual, const AcousticsObjectParams& objectParams,
         FWaveInstance* InOutWaveInstance);
+    void UpdateMetaSoundParameters(
+        FAcousticsSourceState& sourceState, const FTransform& InListenerTransform, const FVector& portalDir,
+        const TritonAcousticParameters& acousticParams, FWaveInstance* InOutWaveInstance);
+    void AddReverbSubmixSends(FAcousticsSourceState& sourceState, FWaveInstance* InOutWaveInstance);
     inline FName GetSourceName(const uint32 SourceId)
     {
-        return FName(FString::Printf(TEXT("Source_%d"), SourceId));
+        return SourceId < static_cast<uint32>(m_SourceNames.Num())
+                   ? m_SourceNames[SourceId]
+                   : FName(FString::Printf(TEXT("Source_%d"), SourceId));
     }
 
 private:
-    // Holds the last successful query for each source. This is in case a query fails, we can instead use
-    // the last successful query.
-    // Key is the sourceID, value is the last successful query result
-    TMap<uint64_t, AcousticsObjectParams> m_LastSuccessfulQueryMap;
+    // State for all possible sources, indexed by source ID
+    TArray<FAcousticsSourceState> m_SourceStates;
+
+    // Debug names for all possible sources, built once so updates don't format strings
+    TArray<FName> m_SourceNames;
 
     IAcoustics* m_Acoustics;
 
@@ -57,6 +57,14 @@ struct FAcousticsSourceSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustics")
     bool ApplyDynamicOpenings = false;
 
+    /**
+     * Raises or lowers how soon this source gets fresh acoustic parameters when the number of acoustic queries per
+     * frame is limited (PA.QueryBudgetPerFrame). Sources are ranked by loudness and distance in dB, so a priority
+     * of 6 ranks this source like one that is twice as loud.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustics", meta = (UIMin = -40, UIMax = 40))
+    float QueryPriority = 0.0f;
+
     /**
      * All acoustic queries perform interpolation from a set of receiver samples.In some cases,
      * the receiver samples for a query will have large differences in their acoustic parameters.